@@ -37,6 +37,9 @@ protected:
   virtual Real computeQpResidual();
   virtual Real computeQpJacobian();
 
+  /// The qp methods are overridden, so the batched Diffusion loops do not apply
+  virtual bool useBatchedLoops() const { return false; }
+
   Real _diffusivity;
 };
 #endif //EXAMPLEDIFFUSION_H
@@ -35,6 +35,9 @@ protected:
 
   virtual Real computeQpJacobian();
 
+  /// The qp methods are overridden, so the batched TimeDerivative loops do not apply
+  virtual bool useBatchedLoops() const { return false; }
+
   Real _time_coefficient;
 };
 
@@ -34,6 +34,9 @@ protected:
   virtual Real computeQpResidual();
   virtual Real computeQpJacobian();
 
+  /// The qp methods are overridden, so the batched Diffusion loops do not apply
+  virtual bool useBatchedLoops() const { return false; }
+
   const MaterialProperty<Real> & _diffusivity;
 };
 
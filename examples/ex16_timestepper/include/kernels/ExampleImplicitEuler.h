@@ -34,6 +34,9 @@ protected:
 
   virtual Real computeQpJacobian();
 
+  /// The qp methods are overridden, so the batched TimeDerivative loops do not apply
+  virtual bool useBatchedLoops() const { return false; }
+
   const MaterialProperty<Real> & _time_coefficient;
 };
 
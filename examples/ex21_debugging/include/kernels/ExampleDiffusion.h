@@ -38,6 +38,9 @@ protected:
   virtual Real computeQpResidual();
   virtual Real computeQpJacobian();
 
+  /// The qp methods are overridden, so the batched Diffusion loops do not apply
+  virtual bool useBatchedLoops() const { return false; }
+
   /**
    * THIS IS AN ERROR ON PURPOSE!
    *
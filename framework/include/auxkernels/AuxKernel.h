@@ -117,6 +117,9 @@ public:
 protected:
   virtual Real computeValue() = 0;
 
+  /// This callback is called on elemental variables before computeValue() is called at the quadrature points
+  virtual void precalculateValue() {}
+
   /// Subproblem this kernel is part of
   SubProblem & _subproblem;
   /// System this kernel is part of
@@ -41,8 +41,14 @@ public:
 protected:
   virtual Real computeValue();
 
+  /// Evaluates the function at all of the quadrature points at once
+  virtual void precalculateValue();
+
   /// Function being used to compute the value of this kernel
   Function & _func;
+
+  /// The function values at the quadrature points (elemental variables)
+  std::vector<Real> _qp_values;
 };
 
 #endif // FUNCTIONAUX_H
@@ -64,6 +64,9 @@ protected:
   /// The variable name of interest
   std::string _var_name;
 
+  /// The index of the variable in the SolutionUserObject
+  unsigned int _local_var_index;
+
   /// Flag for directly grabbing the data based on the dof
    bool _direct;
 
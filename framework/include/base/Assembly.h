@@ -694,12 +694,25 @@ protected:
 
   unsigned int _max_cached_jacobians;
 
+  /// Permutation of the cached Jacobian entries that groups them by row
+  std::vector<unsigned int> _cached_jacobian_order;
+  /// Columns of the row currently being added by addCachedJacobian()
+  std::vector<dof_id_type> _cached_jacobian_row_cols;
+  /// Values of the row currently being added by addCachedJacobian()
+  DenseMatrix<Number> _cached_jacobian_row_values;
+
   /// Will be true if our preconditioning matrix is a block-diagonal matrix.  Which means that we can take some shortcuts.
   unsigned int _block_diagonal_matrix;
 
   /// Temporary work vector to keep from reallocating it
   std::vector<dof_id_type> _temp_dof_indices;
 
+  ///@{
+  /// Temporary copies of the dof indices passed to cacheJacobianBlock(), which constrains them in place
+  std::vector<dof_id_type> _temp_idof_indices;
+  std::vector<dof_id_type> _temp_jdof_indices;
+  ///@}
+
   /**
    * Storage for cached NodalBC data.
    */
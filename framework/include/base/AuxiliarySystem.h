@@ -95,6 +95,32 @@ public:
    */
   virtual void compute(ExecFlagType type);
 
+  /**
+   * Whether or not the elemental auxiliary variables can be computed in the same element loop as the
+   * residual (see ComputeResidualAndAuxThread).  That is the case when there are no boundary elemental
+   * AuxKernels and the objects evaluated in the residual loop do not couple to any of the variables.
+   * @param type Time flag of which variables should be computed
+   * @param coupled_vars The variables coupled by the objects evaluated in the residual element loop
+   */
+  bool canFuseElementalVars(ExecFlagType type, const std::set<MooseVariable *> & coupled_vars);
+
+  /**
+   * Compute the scalar and nodal auxiliary variables, the elemental ones are computed in the residual
+   * element loop instead.  finishFusedElementalVars() must be called once that loop is done.
+   * @param type Time flag of which variables should be computed
+   */
+  void computeUnfusedVars(ExecFlagType type);
+
+  /**
+   * Update the solution once the elemental auxiliary variables were computed in the residual element loop
+   */
+  void finishFusedElementalVars();
+
+  /**
+   * The AuxKernels executed on a time flag, per thread
+   */
+  std::vector<AuxWarehouse> & auxWarehouses(ExecFlagType type) { return _auxs(type); }
+
   /**
    * Get a list of dependent UserObjects for this exec type
    * @param type Execution flag type
@@ -130,6 +156,9 @@ protected:
   void computeNodalVars(ExecFlagType type);
   void computeElementalVars(ExecFlagType type);
 
+  /// Time derivatives and serialization after the elemental variables were computed
+  void postElementalVars();
+
   FEProblem & _fe_problem;
 
   /// solution vector from nonlinear solver
@@ -154,6 +183,7 @@ protected:
   friend class ComputeNodalAuxVarsThread;
   friend class ComputeNodalAuxBcsThread;
   friend class ComputeElemAuxVarsThread;
+  friend class ComputeResidualAndAuxThread;
   friend class ComputeElemAuxBcsThread;
   friend class ComputeIndicatorThread;
   friend class ComputeMarkerThread;
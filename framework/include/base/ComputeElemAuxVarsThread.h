@@ -34,6 +34,7 @@ public:
   virtual ~ComputeElemAuxVarsThread();
 
   virtual void subdomainChanged();
+  virtual bool needInternalSides();
   virtual void onElement(const Elem *elem);
   virtual void post();
 
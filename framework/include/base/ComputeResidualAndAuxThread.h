@@ -0,0 +1,56 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef COMPUTERESIDUALANDAUXTHREAD_H
+#define COMPUTERESIDUALANDAUXTHREAD_H
+
+#include "ComputeResidualThread.h"
+#include "AuxWarehouse.h"
+// libMesh includes
+#include "libmesh/elem_range.h"
+
+
+class FEProblem;
+class NonlinearSystem;
+class AuxiliarySystem;
+
+/**
+ * Computes the elemental auxiliary variables and the residual in a single loop over the elements.
+ * On each element the AuxKernels are computed first, sharing the reinit of the element and its
+ * materials with the kernels.  This is only valid when the residual does not couple to any of the
+ * elemental auxiliary variables, see AuxiliarySystem::canFuseElementalVars().
+ */
+class ComputeResidualAndAuxThread : public ComputeResidualThread
+{
+public:
+  ComputeResidualAndAuxThread(FEProblem & fe_problem, NonlinearSystem & sys, Moose::KernelType type, AuxiliarySystem & aux_sys, std::vector<AuxWarehouse> & auxs);
+
+  // Splitting Constructor
+  ComputeResidualAndAuxThread(ComputeResidualAndAuxThread & x, Threads::split split);
+
+  virtual ~ComputeResidualAndAuxThread();
+
+  virtual void subdomainChanged();
+
+  void join(const ComputeResidualAndAuxThread & /*y*/);
+
+protected:
+  virtual void computeResidual();
+
+  AuxiliarySystem & _aux_sys;
+  std::vector<AuxWarehouse> & _auxs;
+};
+
+#endif //COMPUTERESIDUALANDAUXTHREAD_H
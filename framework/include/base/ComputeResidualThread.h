@@ -37,12 +37,18 @@ public:
   virtual void onElement(const Elem *elem );
   virtual void onBoundary(const Elem *elem, unsigned int side, BoundaryID bnd_id);
   virtual void onInternalSide(const Elem *elem, unsigned int side);
+  virtual bool needInternalSides();
   virtual void postElement(const Elem * /*elem*/);
   virtual void post();
 
   void join(const ComputeResidualThread & /*y*/);
 
 protected:
+  /**
+   * Compute the residual of the kernels on the current element, the element and its materials are reinited
+   */
+  virtual void computeResidual();
+
   NonlinearSystem & _sys;
   Moose::KernelType _kernel_type;
   unsigned int _num_cached;
@@ -34,6 +34,7 @@ public:
   virtual void onElement(const Elem *elem);
   virtual void onBoundary(const Elem *elem, unsigned int side, BoundaryID bnd_id);
   virtual void onInternalSide(const Elem *elem, unsigned int side);
+  virtual bool needInternalSides();
   virtual void post();
   virtual void subdomainChanged();
 
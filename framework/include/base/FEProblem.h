@@ -221,6 +221,38 @@ public:
    */
   virtual void clearActiveElementalMooseVariables(THREAD_ID tid);
 
+  /**
+   * Set the material properties needed by the objects of the current calculation.  Only the
+   * materials supplying them (directly or through other materials) are computed by the
+   * reinitMaterials*() methods.  Materials with stateful properties are always computed.
+   * @param mat_prop_names The names of the material properties that need to be computed
+   * @param tid The thread id
+   */
+  virtual void setActiveMaterialProperties(const std::set<std::string> & mat_prop_names, THREAD_ID tid);
+
+  /**
+   * Get the material properties needed by the current calculation.
+   *
+   * @param tid The thread id
+   */
+  virtual const std::set<std::string> & getActiveMaterialProperties(THREAD_ID tid);
+
+  /**
+   * Whether or not a list of active material properties has been set.
+   *
+   * @return True if there has been a list of active material properties set, False otherwise
+   */
+  virtual bool hasActiveMaterialProperties(THREAD_ID tid);
+
+  /**
+   * Clear the active material properties.  If there are no active properties then all of the
+   * materials will be computed.  Call this after finishing the computation that was using a
+   * restricted set of material properties.
+   *
+   * @param tid The thread id
+   */
+  virtual void clearActiveMaterialProperties(THREAD_ID tid);
+
   virtual void createQRules(QuadratureType type, Order order, Order volume_order=INVALID_ORDER, Order face_order=INVALID_ORDER);
 
   /**
@@ -429,6 +461,13 @@ public:
   virtual void reinitMaterialsFace(SubdomainID blk_id, THREAD_ID tid, bool swap_stateful = true);
   virtual void reinitMaterialsNeighbor(SubdomainID blk_id, THREAD_ID tid, bool swap_stateful = true);
   virtual void reinitMaterialsBoundary(BoundaryID boundary_id, THREAD_ID tid, bool swap_stateful = true);
+
+  /**
+   * The materials of a list that have to be computed for the active material properties, in the
+   * same order.  This is the list itself when no active material properties were set.
+   * @see setActiveMaterialProperties()
+   */
+  std::vector<Material *> & activeMaterials(std::vector<Material *> & materials, THREAD_ID tid);
   /*
    * Swap back underlying data storing stateful material properties
    */
@@ -943,6 +982,16 @@ protected:
   // materials
   std::vector<MaterialWarehouse> _materials;
 
+  /// The material properties needed by the current calculation
+  std::vector<std::set<std::string> > _active_material_property_names;
+
+  /// Whether or not there is currently a list of active material properties
+  /* This needs to remain <unsigned int> for threading purposes */
+  std::vector<unsigned int> _has_active_material_properties;
+
+  /// The materials needed for the active material properties, keyed by the list (in the MaterialWarehouse) they were taken from
+  std::vector<std::map<const std::vector<Material *> *, std::vector<Material *> > > _active_materials;
+
   // indicators
   std::vector<IndicatorWarehouse> _indicators;
 
@@ -985,6 +1034,13 @@ protected:
 
   void computeUserObjectsInternal(ExecFlagType type, UserObjectWarehouse::GROUP group);
 
+  /**
+   * Reduces the values of the user objects in parallel (in one fused reduction, see
+   * UserObject::registerReductions()), finalizes them and stores the postprocessor values
+   * @param user_objects The user objects, already joined across the threads
+   */
+  void finalizeUserObjects(const std::vector<UserObject *> & user_objects);
+
 protected:
   void checkUserObjects();
 
@@ -1062,6 +1118,15 @@ private:
 
   bool _error_on_jacobian_nonzero_reallocation;
 
+  /// Whether or not the elemental AuxKernels on 'linear' are computed in the residual element loop
+  bool _fuse_element_loops;
+
+  /**
+   * Whether or not the elemental AuxKernels on 'linear' can be computed in the residual element loop,
+   * i.e. none of the objects evaluated in between or in that loop depend on their values
+   */
+  bool canFuseElementLoops();
+
   /**
    * NOTE: This is an internal function meant for MOOSE use only!
    *
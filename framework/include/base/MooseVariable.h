@@ -185,6 +185,17 @@ public:
    */
   void computePerturbedElemValues(unsigned i, Real scale, Real& h);
 
+  /**
+   * Compute values at interior quadrature points
+   * when several of this variable's elem dofs are
+   * perturbed at the same time.  The perturbation of
+   * each dof is computed like above.
+   * @param idxs The element dofs to perturb
+   * @param scale Controls the size of the perturbations
+   * @param h Filled with the perturbation of each dof in idxs
+   */
+  void computePerturbedElemValues(const std::vector<unsigned int> & idxs, Real scale, std::vector<Real> & h);
+
   /**
    * Restore the values the variable had before a call to
    * computePerturbedElemValues().
@@ -379,14 +390,14 @@ protected:
   const MooseArray<Point> & _normals;
 
   VariableValue _u, _u_bak;
-  VariableValue _u_old, _u_old_bak;
-  VariableValue _u_older, _u_older_bak;
+  VariableValue _u_old;
+  VariableValue _u_older;
   VariableGradient  _grad_u, _grad_u_bak;
-  VariableGradient  _grad_u_old, _grad_u_old_bak;
-  VariableGradient  _grad_u_older, _grad_u_older_bak;
+  VariableGradient  _grad_u_old;
+  VariableGradient  _grad_u_older;
   VariableSecond _second_u, _second_u_bak;
-  VariableSecond _second_u_old, _second_u_old_bak;
-  VariableSecond _second_u_older, _second_u_older_bak;
+  VariableSecond _second_u_old;
+  VariableSecond _second_u_older;
 
   VariableValue _u_neighbor;
   VariableValue _u_old_neighbor;
@@ -401,11 +412,11 @@ protected:
   // time derivatives
 
   /// u_dot (time derivative)
-  VariableValue _u_dot, _u_dot_bak;
+  VariableValue _u_dot;
   VariableValue _u_dot_neighbor, _u_dot_bak_neighbor;
 
   /// derivative of u_dot wrt u
-  VariableValue _du_dot_du, _du_dot_du_bak;
+  VariableValue _du_dot_du;
   VariableValue _du_dot_du_neighbor, _du_dot_du_bak_neighbor;
 
   // nodal stuff
@@ -402,6 +402,11 @@ public:
    */
   bool doingDG() const;
 
+  /**
+   * Compute the elemental AuxKernels executed on 'linear' in the residual element loop, see ComputeResidualAndAuxThread
+   */
+  void fuseElementalAuxKernels(bool fuse) { _fuse_elemental_aux_kernels = fuse; }
+
   //@{
   /**
    * Updates the active kernels/dgkernels in the warehouse for the
@@ -564,6 +569,9 @@ protected:
 
   bool _print_all_var_norms;
 
+  /// Whether or not the elemental AuxKernels are computed in the residual element loop
+  bool _fuse_elemental_aux_kernels;
+
   void getNodeDofs(unsigned int node_id, std::vector<dof_id_type> & dofs);
 };
 
@@ -77,6 +77,16 @@ public:
    */
   virtual void onInternalSide(const Elem *elem, unsigned int side);
 
+  /**
+   * Whether or not onInternalSide() needs to be called for the current element.  When this
+   * returns false the loop only visits the boundary sides of each element, so interior
+   * elements skip the side loop entirely.  Derived classes that don't do any work on internal
+   * sides (e.g. no active DG objects) should override this.
+   *
+   * @return true to visit internal sides, false to skip them.
+   */
+  virtual bool needInternalSides() { return true; }
+
   /**
    * Called every time the current subdomain changes (i.e. the subdomain of _this_ element
    * is not the same as the subdomain of the last element).  Beware of over-using this!
@@ -157,17 +167,36 @@ ThreadedElementLoopBase<RangeType>::operator () (const RangeType & range, bool b
 
       onElement(elem);
 
-      for (unsigned int side=0; side<elem->n_sides(); side++)
-      {
-        std::vector<BoundaryID> boundary_ids = _mesh.boundaryIDs(elem, side);
-
-        if (boundary_ids.size() > 0)
-          for (std::vector<BoundaryID>::iterator it = boundary_ids.begin(); it != boundary_ids.end(); ++it)
-            onBoundary(elem, side, *it);
+      // Boundary sides come from the table cached by the mesh when possible, which avoids allocating
+      MooseMesh::elem_bnd_side_iterator bnd_side_it, bnd_side_end;
+      bool have_bnd_sides = _mesh.elemBoundarySides(elem, bnd_side_it, bnd_side_end);
 
-        if (elem->neighbor(side) != NULL)
-          onInternalSide(elem, side);
-      } // sides
+      if (have_bnd_sides && !needInternalSides())
+      {
+        // Only the boundary sides have work to do, for an interior element there is nothing to visit
+        for (; bnd_side_it != bnd_side_end; ++bnd_side_it)
+          onBoundary(elem, bnd_side_it->first, bnd_side_it->second);
+      }
+      else
+        for (unsigned int side=0; side<elem->n_sides(); side++)
+        {
+          if (have_bnd_sides)
+          {
+            for (; bnd_side_it != bnd_side_end && bnd_side_it->first == side; ++bnd_side_it)
+              onBoundary(elem, side, bnd_side_it->second);
+          }
+          else
+          {
+            std::vector<BoundaryID> boundary_ids = _mesh.boundaryIDs(elem, side);
+
+            if (boundary_ids.size() > 0)
+              for (std::vector<BoundaryID>::iterator it = boundary_ids.begin(); it != boundary_ids.end(); ++it)
+                onBoundary(elem, side, *it);
+          }
+
+          if (elem->neighbor(side) != NULL)
+            onInternalSide(elem, side);
+        } // sides
       postElement(elem);
 
     } // range
@@ -21,6 +21,11 @@
 
 class DisplacedProblem;
 
+/**
+ * Moves the nodes of the displaced mesh to the reference position plus the displacements.
+ * The displacements of the nodes in a range are gathered from the solution vectors all at
+ * once, see gatherDisplacements().
+ */
 class UpdateDisplacedMeshThread
 {
 public:
@@ -30,10 +35,32 @@ public:
   void operator() (const NodeRange & range) const;
 
 protected:
+  /**
+   * Move the nodes in the range along the displacement variables of one system
+   * @param range The displaced nodes to move
+   * @param soln The solution holding the displacements
+   * @param sys_num The number of the system
+   * @param var_nums The displacement variables in the system
+   * @param directions The direction of each of the variables
+   */
+  void gatherDisplacements(const SemiLocalNodeRange & range, const NumericVector<Number> & soln, unsigned int sys_num,
+                           const std::vector<unsigned int> & var_nums, const std::vector<unsigned int> & directions) const;
+
   DisplacedProblem & _problem;
   MooseMesh & _ref_mesh;
   const NumericVector<Number> & _nl_soln;
   const NumericVector<Number> & _aux_soln;
+
+  /// The displacement variables in the nonlinear system and their directions
+  std::vector<unsigned int> _var_nums;
+  std::vector<unsigned int> _var_nums_directions;
+
+  /// The displacement variables in the auxiliary system and their directions
+  std::vector<unsigned int> _aux_var_nums;
+  std::vector<unsigned int> _aux_var_nums_directions;
+
+  unsigned int _nonlinear_system_number;
+  unsigned int _aux_system_number;
 };
 
 #endif /* UPDATEDISPLACEDMESHTHREAD_H */
@@ -17,6 +17,7 @@
 
 #include "Moose.h"
 #include "MooseArray.h"
+#include "PointLocationCache.h"
 
 // libMesh
 #include "libmesh/elem.h"
@@ -70,13 +71,31 @@ public:
 
   /**
    * Called during FEProblem::meshChanged() to update the PointLocator
-   * object used by the DiracKernels.
+   * object used by the DiracKernels.  This also forgets the cached
+   * locations of the points.
    */
   void updatePointLocator(const MooseMesh& mesh);
 
+  /**
+   * Called when the nodes of the mesh moved: the PointLocator is only
+   * rebuilt by the next call to updateStalePointLocator(), so that
+   * moving the mesh costs nothing when no point is located on it
+   * before it moves again.
+   */
+  void invalidatePointLocator();
+
+  /**
+   * Rebuild the PointLocator if the mesh moved since it was built.
+   * This has to be called on all of the processors at once, before
+   * the points are located again.
+   */
+  void updateStalePointLocator(const MooseMesh& mesh);
+
   /**
    * Used by client DiracKernel classes to determine the Elem in which
-   * the Point p resides.  Uses the PointLocator owned by this object.
+   * the Point p resides.  Uses the PointLocator owned by this object,
+   * the points that were already found are not searched for again
+   * until the mesh changes.
    */
   const Elem * findPoint(Point p, const MooseMesh& mesh);
 
@@ -90,8 +109,11 @@ protected:
   /// The DiracKernelInfo object manages a PointLocator object which is used
   /// by all DiracKernels to find Points.  It needs to be centrally managed and it
   /// also needs to be rebuilt in FEProblem::meshChanged() to work with Mesh
-  /// adaptivity.
-  UniquePtr<PointLocatorBase> _point_locator;
+  /// adaptivity.  The locations found with it are cached along with it.
+  PointLocationCache _point_locations;
+
+  /// Whether the mesh moved since the PointLocator was built
+  bool _point_locator_stale;
 };
 
 #endif //DIRACKERNELINFO_H
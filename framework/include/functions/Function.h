@@ -23,6 +23,7 @@
 #include "Restartable.h"
 #include "MeshChangedInterface.h"
 #include "ScalarCoupleable.h"
+#include "MooseArray.h"
 
 // libMesh
 #include "libmesh/vector_value.h"
@@ -69,6 +70,16 @@ public:
    */
   virtual Real value(Real t, const Point & p);
 
+  /**
+   * Evaluate the scalar function at a set of points at once, e.g. at all of the
+   * quadrature points of an element.  By default this calls value() for each point,
+   * functions override it when they can evaluate the points more efficiently.
+   * \param t The time
+   * \param points The Points in space (x,y,z)
+   * \param values The values of the function at the points
+   */
+  virtual void values(Real t, const MooseArray<Point> & points, std::vector<Real> & values);
+
   /**
    * Override this to evaluate the vector function at a point (t,x,y,z), by default
    * this returns a zero vector, you must override it.
@@ -66,6 +66,13 @@ public:
    */
   virtual Real value(Real t, const Point & pt);
 
+  /**
+   * Evaluate the equation at a set of points, the Postprocessor values
+   * are only fetched once for all of the points.  Derived classes that
+   * override value() have to override this too.
+   */
+  virtual void values(Real t, const MooseArray<Point> & points, std::vector<Real> & values);
+
   /**
    * Evaluate the gradient of the function. This is computed in libMesh
    * through automatic symbolic differentiation.
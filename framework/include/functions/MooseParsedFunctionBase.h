@@ -73,6 +73,9 @@ protected:
 
   /// Values passed by the user, they may be Reals for Postprocessors
   const std::vector<std::string> _vals;
+
+  /// Just-in-time compile the function (see MooseParsedFunctionWrapper)
+  const bool _enable_jit;
 };
 
 #endif // MOOSEPARSEDFUNCTIONBASE_H
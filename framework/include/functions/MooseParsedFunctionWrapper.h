@@ -26,6 +26,7 @@
 
 // MOOSE includes
 #include "FEProblem.h"
+#include "FunctionParserUtils.h"
 
 /**
  * A wrapper class for creating and evaluating parsed functions via the
@@ -44,12 +45,15 @@ public:
    * @param function_str A string that contains the function to evaluate
    * @param vars A vector of variable names contained within the function
    * @param vals A vector of variable values, matching the variables defined in vars
+   * @param tid The thread id
+   * @param enable_jit Just-in-time compile the scalar function or the components of the vector function
    */
   MooseParsedFunctionWrapper(FEProblem & feproblem,
                               const std::string & function_str,
                               const std::vector<std::string> & vars,
                               const std::vector<std::string> & vals,
-                              const THREAD_ID tid = 0);
+                              const THREAD_ID tid = 0,
+                              bool enable_jit = false);
 
   /**
    * Class destruction
@@ -66,6 +70,15 @@ public:
   template<typename T>
   T evaluate(Real t, const Point & p);
 
+  /**
+   * Evaluate the scalar function at a set of points, the postprocessor and scalar
+   * variable values are only updated once for all the points
+   * @param t The time
+   * @param points The points
+   * @param values The values of the function at the points
+   */
+  void evaluate(Real t, const MooseArray<Point> & points, std::vector<Real> & values);
+
   /**
    * Evaluate the gradient of the function which libMesh provides through
    * automatic differentiation
@@ -78,6 +91,12 @@ public:
    */
   Real evaluateDot(Real t, const Point & p);
 
+  /**
+   * Whether the function is evaluated by the directly parsed (optimized and optionally JIT compiled)
+   * functions instead of the libMesh::ParsedFunction
+   */
+  bool isParsedDirectly() const;
+
 private:
 
   /// Reference to the FEProblem object
@@ -98,6 +117,22 @@ private:
   /// Pointer to the libMesh::ParsedFunction object
   ParsedFunction<Real> * _function_ptr;
 
+  /**
+   * The scalar function, parsed directly so that it is optimized (and optionally JIT compiled) like
+   * the other parsed objects, see FunctionParserUtils.  It is NULL if the function is not a plain
+   * scalar expression, in which case the libMesh::ParsedFunction is used.
+   */
+  FunctionParserUtils::ADFunction * _scalar_function;
+
+  /// The components of a vector valued function, parsed like _scalar_function (empty for scalar functions)
+  std::vector<FunctionParserUtils::ADFunction *> _component_functions;
+
+  /// The arguments of _scalar_function and _component_functions: x, y, z, t, followed by the values of the variables
+  std::vector<Real> _scalar_params;
+
+  /// Pointers to the values of all of the variables in the libMesh::ParsedFunction
+  std::vector<Real *> _var_addr;
+
   /// Stores the relative location of variables (in _vars) that are connected to Postprocessors
   std::vector<unsigned int> _pp_index;
 
@@ -127,6 +162,21 @@ private:
    */
   void update();
 
+  /**
+   * Updates the variable values for use in _scalar_function
+   */
+  void updateScalarParams();
+
+  /**
+   * Evaluates _scalar_function at a point, the arguments must be up to date
+   */
+  Real evaluateScalar(Real t, const Point & p);
+
+  /**
+   * Sets the point and time arguments in _scalar_params
+   */
+  void setPoint(Real t, const Point & p);
+
   // moose_unit needs access
   friend class ParsedFunctionTest;
 
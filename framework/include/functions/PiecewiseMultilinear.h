@@ -66,12 +66,28 @@ private:
   /// the grid
   std::vector<std::vector<Real> > _grid;
 
+  /// the function values at the grid points, see GriddedData
+  std::vector<Real> _fcn;
+
+  /// the offset in _fcn between neighboring grid points along each axis
+  std::vector<unsigned int> _stride;
+
+  /// whether the grid points along each axis are (approximately) uniformly spaced
+  std::vector<bool> _uniform;
+
+  /// the inverse of the grid spacing along each uniformly spaced axis
+  std::vector<Real> _inv_spacing;
+
+  /// the maximum dimension of the grid (one for each of x, y, z and t)
+  static const unsigned int MAX_DIM = 4;
+
   /**
    * This does the core work.  Given a point, pt, defined
    * on the grid (not the MOOSE simulation reference frame),
    * interpolate the gridded data to this point
+   * @param pt The point, it has _dim entries
    */
-  Real sample(const std::vector<Real> & pt);
+  Real sample(const Real * pt);
 
   /**
    * Operates on monotonically increasing in_arr.
@@ -84,7 +100,13 @@ private:
    * @param lower_x Upon return will contain lower_x specified above
    * @param upper_x Upon return will contain upper_x specified above
    */
-  void getNeighborIndices(std::vector<Real> in_arr, Real x, unsigned int & lower_x, unsigned int & upper_x);
+  void getNeighborIndices(const std::vector<Real> & in_arr, Real x, unsigned int & lower_x, unsigned int & upper_x);
+
+  /**
+   * Same as getNeighborIndices, for the i_th axis of the grid.
+   * The search is O(1) on uniformly spaced axes, otherwise it is a binary search.
+   */
+  void getAxisNeighborIndices(unsigned int i, Real x, unsigned int & lower_x, unsigned int & upper_x);
 };
 
 #endif //PIECEWISEMULTILINEAR_H
@@ -67,6 +67,12 @@ protected:
   /// The variable name to extract from the file
   std::string _var_name;
 
+  /// The index of the variable in the SolutionUserObject
+  unsigned int _local_var_index;
+
+  /// The thread this function is evaluated on
+  THREAD_ID _tid;
+
   /// Factor to scale the solution by (default = 1)
   const Real _scale_factor;
 
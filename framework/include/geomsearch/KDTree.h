@@ -0,0 +1,137 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef KDTREE_H
+#define KDTREE_H
+
+#include "Moose.h"
+
+// libMesh includes
+#include "libmesh/point.h"
+
+// System includes
+#include <vector>
+
+/**
+ * A spatial index over a fixed set of points that answers k-nearest-neighbor queries.
+ *
+ * The tree is built by recursively splitting the points at the median of the widest
+ * coordinate direction.  Every node stores the bounding box of the points beneath it, so
+ * when the points move without changing identity (e.g. a displaced mesh) the tree can be
+ * refit in O(N) instead of being rebuilt.  A refit tree is always correct, but the
+ * queries get slower as the boxes start to overlap, so callers should rebuild
+ * occasionally when the motion is large.
+ *
+ * Equidistant points are reported in order of their index, so a nearest neighbor query
+ * returns the same point a linear scan over the input would.
+ *
+ * Queries are read-only and can be issued concurrently from multiple threads.
+ */
+class KDTree
+{
+public:
+  /**
+   * @param max_leaf_size The maximum number of points stored in a leaf node
+   */
+  KDTree(unsigned int max_leaf_size = 10);
+
+  /**
+   * Build the tree from scratch over the given points.  The points are copied and
+   * query results are reported as indices into this vector.
+   */
+  void build(const std::vector<Point> & points);
+
+  /**
+   * Update the node bounding boxes for new positions of the same points that the tree
+   * was built with (same size, same ordering) without changing the tree topology.
+   */
+  void refit(const std::vector<Point> & points);
+
+  /**
+   * Find the (up to) k points closest to query_point.
+   * @param query_point The point to search around
+   * @param k The number of points to find
+   * @param indices Filled with the indices of the closest points, nearest first
+   * @param distances Filled with the distances to the closest points, nearest first
+   */
+  void neighborSearch(const Point & query_point, unsigned int k,
+                      std::vector<unsigned int> & indices, std::vector<Real> & distances) const;
+
+  /**
+   * Find the closest point to query_point.  Returns the index of the point and
+   * fills in its distance.  The tree must not be empty.
+   */
+  unsigned int nearestNeighbor(const Point & query_point, Real & distance) const;
+
+  /**
+   * The number of points in the tree
+   */
+  unsigned int size() const { return _points.size(); }
+
+  /**
+   * Whether or not there are any points in the tree
+   */
+  bool empty() const { return _points.empty(); }
+
+protected:
+  /**
+   * A node of the tree.  Leaves (left == invalid_node) own the index
+   * range [begin, end) in _index.
+   */
+  struct KDNode
+  {
+    Point _min;
+    Point _max;
+    unsigned int _begin;
+    unsigned int _end;
+    unsigned int _left;
+    unsigned int _right;
+  };
+
+  /// Candidate (squared distance, point index) kept in a max-heap during a search
+  typedef std::pair<Real, unsigned int> Candidate;
+
+  /// Recursively build the node holding _index[begin, end) and return its id
+  unsigned int buildNode(unsigned int begin, unsigned int end);
+
+  /// Recompute the bounding box of a node (and its children) from _points
+  void refitNode(unsigned int node_id);
+
+  /// Compute the bounding box of the points in _index[begin, end)
+  void computeBounds(unsigned int begin, unsigned int end, Point & min, Point & max) const;
+
+  /// Squared distance from a point to the bounding box of a node (zero when inside)
+  Real boxDistanceSquared(const KDNode & node, const Point & p) const;
+
+  /// Recursively search a node, keeping the k best candidates in the heap
+  void searchNode(unsigned int node_id, const Point & query_point, unsigned int k,
+                  std::vector<Candidate> & heap) const;
+
+  /// Sentinel for a missing child
+  static const unsigned int invalid_node;
+
+  /// The maximum number of points in a leaf
+  unsigned int _max_leaf_size;
+
+  /// The points being indexed
+  std::vector<Point> _points;
+
+  /// Permutation of the point indices such that every leaf owns a contiguous range
+  std::vector<unsigned int> _index;
+
+  /// The nodes of the tree, the root is node 0
+  std::vector<KDNode> _nodes;
+};
+
+#endif //KDTREE_H
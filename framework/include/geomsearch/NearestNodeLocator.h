@@ -19,6 +19,7 @@
 #include "MooseMesh.h"
 #include "libmesh/vector_value.h"
 #include "Restartable.h"
+#include "KDTree.h"
 
 // libMesh
 #include "libmesh/libmesh_common.h"
@@ -52,6 +53,14 @@ public:
    */
   void reinit();
 
+  /**
+   * Rebuild the slave node patches without throwing away the spatial index of the
+   * master nodes.  If the set of master nodes is unchanged the index is only refit
+   * to the current node positions.  Called when the patch needs updating because of
+   * mesh displacement.
+   */
+  void updatePatch();
+
   /**
    * Valid to call this after findNodes() has been called to get the distance to the nearest node.
    */
@@ -92,6 +101,12 @@ protected:
 
   NodeIdRange * _slave_node_range;
 
+  /// The master nodes indexed by _master_tree
+  std::vector<dof_id_type> _trial_master_nodes;
+
+  /// Spatial index over the positions of _trial_master_nodes
+  KDTree _master_tree;
+
 public:
   std::map<dof_id_type, NearestNodeInfo> _nearest_node_info;
 
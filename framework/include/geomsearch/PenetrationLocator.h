@@ -88,6 +88,36 @@ public:
   Real getTangentialTolerance() {return _tangential_tolerance;}
   void skipOffProcessSlaveNodes( bool skip_them = true );
 
+  /// The number of slave nodes whose candidate master faces were searched by the last call to detectPenetration()
+  unsigned int numSearchedNodes() const { return _num_searched_nodes; }
+  /**
+   * The number of slave nodes whose search was skipped by the last call to detectPenetration():
+   * the nodes found again on the face they were on, and the nodes held off the search by the
+   * incremental search (see MooseMesh::getIncrementalPenetrationSearch())
+   */
+  unsigned int numSkippedNodes() const { return _num_skipped_nodes; }
+  /// The number of the skipped slave nodes that were held off the search for being off the master faces
+  unsigned int numOffFaceSkippedNodes() const { return _num_off_face_skipped_nodes; }
+
+  /**
+   * What the incremental search remembers of the last search of a slave node that was
+   * found off all of the master faces near it
+   */
+  struct IncrementalSearchData
+  {
+    IncrementalSearchData() :
+        _reach(0),
+        _master_motion(0)
+    {}
+
+    /// The position of the node
+    Point _position;
+    /// How far the node was off the faces, beyond the tangential tolerance
+    Real _reach;
+    /// The value of _master_motion
+    Real _master_motion;
+  };
+
 protected:
   /// Check whether found candidates are reasonable
   bool _check_whether_reasonable;
@@ -97,6 +127,19 @@ protected:
   Real _normal_smoothing_distance; // Distance from edge (in parametric coords) within which to perform normal smoothing
   NORMAL_SMOOTHING_METHOD _normal_smoothing_method;
   bool _skip_off_process_slaves; // Do not PenetrationInfos for nodes that are not locally owned.
+
+  /// Skip the search of the slave nodes that can not have moved onto a master face since their last search
+  bool _incremental_search;
+  /// The state of the slave nodes found off the master faces at their last search
+  std::map<dof_id_type, IncrementalSearchData> _incremental_search_data;
+  /// The positions of the master nodes at the last call to detectPenetration()
+  std::map<dof_id_type, Point> _master_node_positions;
+  /// The sum over the calls to detectPenetration() of the largest motion of the master nodes since the previous call
+  Real _master_motion;
+
+  unsigned int _num_searched_nodes;
+  unsigned int _num_skipped_nodes;
+  unsigned int _num_off_face_skipped_nodes;
 };
 
 /**
@@ -41,7 +41,10 @@ public:
                     std::vector<dof_id_type> & elem_list,
                     std::vector<unsigned short int> & side_list,
                     std::vector<boundary_id_type> & id_list,
-                    bool skip_off_process_slaves);
+                    bool skip_off_process_slaves,
+                    bool incremental_search,
+                    std::map<dof_id_type, PenetrationLocator::IncrementalSearchData> & incremental_search_data,
+                    Real master_motion);
 
   // Splitting Constructor
   PenetrationThread(PenetrationThread & x, Threads::split split);
@@ -50,6 +53,10 @@ public:
 
   void join(const PenetrationThread & other);
 
+  unsigned int numSearchedNodes() const { return _num_searched_nodes; }
+  unsigned int numSkippedNodes() const { return _num_skipped_nodes; }
+  unsigned int numOffFaceSkippedNodes() const { return _num_off_face_skipped_nodes; }
+
 protected:
   SubProblem & _subproblem;
   // The Mesh
@@ -85,6 +92,14 @@ protected:
   THREAD_ID _tid;
   bool _skip_off_process_slaves;
 
+  bool _incremental_search;
+  std::map<dof_id_type, PenetrationLocator::IncrementalSearchData> & _incremental_search_data;
+  Real _master_motion;
+
+  unsigned int _num_searched_nodes;
+  unsigned int _num_skipped_nodes;
+  unsigned int _num_off_face_skipped_nodes;
+
   enum CompeteInteractionResult
   {
     FIRST_WINS,
@@ -173,7 +188,8 @@ protected:
                     const Node* slave_node,
                     const Elem* elem,
                     const std::vector<const Node*> &nodes_that_must_be_on_side,
-                    const bool check_whether_reasonable = false);
+                    const bool check_whether_reasonable = false,
+                    const PenetrationInfo * previous_info = NULL);
 
   void
   getSidesOnMasterBoundary(std::vector<unsigned int> &sides,
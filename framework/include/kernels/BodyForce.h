@@ -33,8 +33,14 @@ public:
 protected:
   virtual Real computeQpResidual();
 
+  virtual bool computeLocalResidual();
+  virtual bool computeLocalJacobian();
+
   Real _value;
   Function & _function;
+
+  /// The scaled function value at each quadrature point, used by the batched residual
+  std::vector<Real> _qp_factors;
 };
 
 #endif
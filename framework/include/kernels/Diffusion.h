@@ -32,6 +32,9 @@ public:
 protected:
   virtual Real computeQpResidual();
   virtual Real computeQpJacobian();
+
+  virtual bool computeLocalResidual();
+  virtual bool computeLocalJacobian();
 };
 
 
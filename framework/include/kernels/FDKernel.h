@@ -23,6 +23,17 @@ class FDKernel;
 template<>
 InputParameters validParams<FDKernel>();
 
+/**
+ * A Kernel that computes its Jacobian by finite differencing its residual.
+ *
+ * By default every element dof is perturbed on its own, which costs one element residual
+ * evaluation per dof.  With fd_coloring the structural nonzero pattern of the element
+ * Jacobian is found from the variable coupling and the overlap of the test and shape
+ * functions at the quadrature points, and the dofs whose columns do not share a nonzero
+ * row are then perturbed together.  The blocks of the variables the kernel is not coupled
+ * to cost nothing, and kernels whose residual entries only depend on a few of the element
+ * dofs (e.g. with a nodal quadrature) need fewer residual evaluations.
+ */
 class FDKernel :
   public Kernel
 {
@@ -41,6 +52,9 @@ public:
    * @param jvar The number of the scalar variable
    */
   virtual void computeOffDiagJacobianScalar(unsigned int jvar);
+
+  virtual void jacobianSetup();
+
  protected:
   /**
    * Computes the residual when the current state of j-th variable
@@ -50,7 +64,43 @@ public:
   virtual DenseVector<Number>
     perturbedResidual(unsigned int ivar, unsigned int i, Real perturbation_scale, Real& perturbation);
 
+  /**
+   * Computes the residual when the current state of the ivar-th variable
+   * at several element dofs is perturbed at the same time.
+   * @param ivar The variable to perturb
+   * @param idxs The element dofs to perturb
+   * @param perturbation_scale Controls the size of the perturbations
+   * @param perturbations Filled with the perturbation of each dof in idxs
+   */
+  virtual DenseVector<Number>
+    perturbedResidual(unsigned int ivar, const std::vector<unsigned int> & idxs, Real perturbation_scale, std::vector<Real> & perturbations);
+
+  /// The nonzero pattern of an element Jacobian block and the groups of columns that are perturbed together
+  struct Coloring
+  {
+    std::vector<std::vector<bool> > _nonzero;
+    std::vector<std::vector<unsigned int> > _colors;
+  };
+
+  /**
+   * Finds the structural nonzero pattern of the element Jacobian block of the jvar-th
+   * variable on the current element.
+   */
+  void findPattern(unsigned int jvar, Coloring & coloring);
+
+  /**
+   * Groups the columns of the nonzero pattern so that no two columns of a group have
+   * a nonzero in the same row.  The columns without any nonzero are left out.
+   */
+  void colorColumns(Coloring & coloring);
+
   Real _scale;
+
+  /// Whether or not to perturb the structurally independent dofs at the same time
+  bool _fd_coloring;
+
+  /// The colorings found since the last jacobianSetup(), keyed by the coupled variable, the element type and the number of element dofs
+  std::map<std::pair<unsigned int, std::pair<ElemType, unsigned int> >, Coloring> _colorings;
 };
 
 #endif /* FDKERNEL_H */
@@ -49,6 +49,30 @@ protected:
   /// This callback is used for Kernels that need to perturb residual calculations
   virtual void precalculateResidual();
 
+  /**
+   * Batched alternatives to the quadrature point loops in computeResidual() and computeJacobian().
+   * Kernels with simple quadrature point expressions can override these to fill _local_re (or
+   * _local_ke) for every test (and shape) function in one call.  The loops then run over
+   * contiguous arrays without a virtual call and member updates per (i, j, qp), which leaves
+   * the compiler free to optimize (and where the floating point model allows, vectorize) them.
+   * Implementations must add the quadrature point contributions in the same order as the
+   * generic loops so that the results don't change.
+   *
+   * @return true if the local residual (Jacobian) was computed, false to use the per qp loops
+   */
+  virtual bool computeLocalResidual();
+  virtual bool computeLocalJacobian();
+
+  /**
+   * Whether computeLocalResidual() and computeLocalJacobian() are called at all.  The batched
+   * methods hard code the terms of the class that implements them, so a class deriving from such
+   * a kernel that overrides computeQpResidual() or computeQpJacobian() must return false here.
+   */
+  virtual bool useBatchedLoops() const;
+
+  /// Fills _qp_weights, to be called by the batched methods before they use it
+  void computeQpWeights();
+
   /// Holds the solution at current quadrature points
   VariableValue & _u;
 
@@ -60,6 +84,9 @@ protected:
 
   /// Derivative of u_dot with respect to u
   VariableValue & _du_dot_du;
+
+  /// _JxW * _coord at each quadrature point, see computeQpWeights()
+  std::vector<Real> _qp_weights;
 };
 
 #endif /* KERNEL_H */
@@ -32,5 +32,7 @@ protected:
   virtual Real computeQpResidual();
   virtual Real computeQpJacobian();
 
+  virtual bool computeLocalResidual();
+  virtual bool computeLocalJacobian();
 };
 #endif //REACTION_H
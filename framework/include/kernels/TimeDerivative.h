@@ -34,6 +34,9 @@ protected:
   virtual Real computeQpResidual();
   virtual Real computeQpJacobian();
 
+  virtual bool computeLocalResidual();
+  virtual bool computeLocalJacobian();
+
   bool _lumping;
 };
 
@@ -154,6 +154,11 @@ public:
 
   void checkStatefulSanity() const;
 
+  /**
+   * Whether or not this material declares old or older properties
+   */
+  bool hasStatefulProperties() const { return _has_stateful_property; }
+
   /**
    * Check if a material property is valid for all blocks of this Material
    *
@@ -32,6 +32,7 @@
 class MooseMesh;
 class FEProblem;
 class MaterialPropertyStorage;
+class AsyncFileWriter;
 
 /**
  * This class saves stateful material properties into a file.
@@ -43,9 +44,21 @@ public:
   MaterialPropertyIO(FEProblem & fe_problem);
   virtual ~MaterialPropertyIO();
 
-  virtual void write(const std::string & file_name);
+  /**
+   * Write the stateful material properties.
+   * @param shared_file When true the properties of all processors are written to a single file
+   * named file_name instead of one file per processor
+   * @param async_writer When given, the per-processor file is handed to this background writer
+   * @return The number of bytes written by this processor
+   */
+  virtual std::size_t write(const std::string & file_name, bool shared_file = false, AsyncFileWriter * async_writer = NULL);
   virtual void read(const std::string & file_name);
 
+  /**
+   * Write the stateful material properties of this processor to a stream
+   */
+  void writeBlock(std::ostream & out);
+
 protected:
   FEProblem & _fe_problem;
   MooseMesh & _mesh;
@@ -148,6 +148,11 @@ public:
    */
   bool getMaterialPropertyCalled() const { return _get_material_property_called; }
 
+  /**
+   * The names of the material properties retrieved by this object (current, old or older)
+   */
+  const std::set<std::string> & getMatPropDependencies() const { return _material_property_dependencies; }
+
 protected:
 
   /// The name of the object that this interface belongs to
@@ -219,6 +224,9 @@ private:
 
   /// Parameters of the object with this interface
   InputParameters _mi_params;
+
+  /// The names of the material properties retrieved by this object
+  std::set<std::string> _material_property_dependencies;
 };
 
 template<typename T>
@@ -24,6 +24,7 @@
 #include "libmesh/quadrature.h"
 
 #include <vector>
+#include <deque>
 #include <map>
 #include <string>
 
@@ -34,6 +35,10 @@ class QpMap;
 /**
  * Stores the stateful material properties computed by materials.
  *
+ * The current, old and older properties of each (element, side) pair are kept together in a
+ * single slot, so one lookup serves all three states and shifting the properties in time only
+ * rotates which state is which.
+ *
  * Thread-safe
  */
 class MaterialPropertyStorage
@@ -157,9 +162,23 @@ public:
    */
   bool hasOlderProperties() const { return _has_older_prop; }
 
-  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties> > & props() { return *_props_elem; }
-  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties> > & propsOld() { return *_props_elem_old; }
-  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties> > & propsOlder() { return *_props_elem_older; }
+  /**
+   * The current, old and older stateful properties of an element side (side 0 for elemental
+   * material properties).  Storage is created the first time an (element, side) is requested.
+   */
+  MaterialProperties & props(const Elem * elem, unsigned int side) { return slot(elem, side)._props[_current]; }
+  MaterialProperties & propsOld(const Elem * elem, unsigned int side) { return slot(elem, side)._props[_old]; }
+  MaterialProperties & propsOlder(const Elem * elem, unsigned int side) { return slot(elem, side)._props[_older]; }
+
+  /**
+   * Write all of the stored properties (current, old and, if present, older) to a stream
+   */
+  void store(std::ostream & stream, void * context);
+
+  /**
+   * Read properties written by store() back in
+   */
+  void load(std::istream & stream, void * context);
 
   bool hasProperty(const std::string & prop_name) const;
   unsigned int addProperty(const std::string & prop_name);
@@ -172,10 +191,34 @@ public:
   unsigned int getPropertyId (const std::string & prop_name);
 
 protected:
-  // indexing: [element][side]->material_properties
-  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties> > * _props_elem;
-  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties> > * _props_elem_old;
-  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties> > * _props_elem_older;
+  /**
+   * The stateful properties of a single (element, side) pair in all three states
+   */
+  struct PropsSlot
+  {
+    MaterialProperties _props[3];
+  };
+
+  /// Get the slot for an (element, side) pair, creating it if needed
+  PropsSlot & slot(const Elem * elem, unsigned int side);
+
+  /// Write (or read) the properties of a single state in the layout of a HashMap<const Elem *, HashMap<unsigned int, MaterialProperties> >
+  void storeState(std::ostream & stream, unsigned int state, void * context);
+  void loadState(std::istream & stream, unsigned int state, void * context);
+
+  /// indexing: [element][side]->slot, NULL for sides without storage
+  HashMap<const Elem *, std::vector<PropsSlot *> > _slots;
+
+  /// Backing storage for the slots (a deque so that slots don't move as it grows)
+  std::deque<PropsSlot> _slot_pool;
+
+  /// Serializes the creation of new slots
+  Threads::spin_mutex _slot_pool_mutex;
+
+  /// Which entry of PropsSlot::_props holds the current, old and older properties
+  unsigned int _current;
+  unsigned int _old;
+  unsigned int _older;
 
   /// mapping from property name to property ID
   /// NOTE: this is static so the property numbering is global within the simulation (not just FEProblem - should be useful when we will use material properties from
@@ -22,6 +22,7 @@
 #include "MooseTypes.h"
 #include "Restartable.h"
 #include "MooseEnum.h"
+#include "PointLocationCache.h"
 
 // libMesh
 #include "libmesh/mesh.h"
@@ -114,6 +115,17 @@ public:
    */
   std::vector<BoundaryID> boundaryIDs(const Elem *const elem, const unsigned short int side) const;
 
+  /// Iterator over the (side, boundary id) pairs of a single element
+  typedef std::vector<std::pair<unsigned short int, BoundaryID> >::const_iterator elem_bnd_side_iterator;
+
+  /**
+   * Retrieves the (side, boundary id) pairs of the requested element, ordered by side, from
+   * the table cached when the mesh was last prepared or changed.  Unlike boundaryIDs() this
+   * does not allocate.  Returns false if the element isn't in the table, in which case the
+   * iterators are not set and boundaryIDs() must be used instead.
+   */
+  bool elemBoundarySides(const Elem * elem, elem_bnd_side_iterator & begin, elem_bnd_side_iterator & end) const;
+
   /**
    * Returns a const reference to a set of all user-specified
    * boundary IDs.
@@ -259,6 +271,25 @@ public:
    */
   std::vector<const Elem *> & coarsenedElementChildren(const Elem * elem);
 
+  /**
+   * The cache of the elements points were located in, shared by all of the objects sampling this mesh at
+   * fixed points.  It is cleared whenever the mesh changes.  Building its point locator is parallel_only,
+   * so this must be called on all processors before any of them locates a point.
+   */
+  PointLocationCache & pointLocationCache();
+
+  /**
+   * Forget the cached point locations and the point locators, e.g. because the nodes of the mesh
+   * moved.  The point locators are only rebuilt the next time a point is located.
+   */
+  void clearPointLocationCache();
+
+  /**
+   * Forget the cached locations of the points that were not located since the previous call, this keeps
+   * the cache from growing when the sampled points move.
+   */
+  void dropUnusedPointLocations();
+
   /**
    * Clears the "semi-local" node list and rebuilds it.  Semi-local nodes
    * consist of all nodes that belong to local and ghost elements.
@@ -376,6 +407,12 @@ public:
    */
   const MooseEnum & getPatchUpdateStrategy();
 
+  /**
+   * Whether the penetration locators skip the search of the slave nodes that can not
+   * have moved onto a master face since their last search.
+   */
+  bool getIncrementalPenetrationSearch();
+
   /**
    * Implicit conversion operator from MooseMesh -> libMesh::MeshBase.
    */
@@ -758,6 +795,9 @@ protected:
   std::map<dof_id_type, std::vector<dof_id_type> > _node_to_elem_map;
   bool _node_to_elem_map_built;
 
+  /// The elements points were located in, see pointLocationCache()
+  PointLocationCache _point_location_cache;
+
   /**
    * A set of subdomain IDs currently present in the mesh.
    * For parallel meshes, includes subdomains defined on other
@@ -809,6 +849,9 @@ protected:
   /// The patch update strategy
   MooseEnum _patch_update_strategy;
 
+  /// Whether the penetration search is incremental
+  bool _incremental_penetration_search;
+
   /// file_name iff this mesh was read from a file
   std::string _file_name;
 
@@ -931,6 +974,15 @@ private:
   /// Holds a map from subomdain ids to the boundary ids that are attached to it
   std::map<unsigned int, std::set<unsigned int> > _subdomain_boundary_ids;
 
+  /**
+   * Offsets into _elem_boundary_sides indexed by element id: the boundary sides of element i are
+   * stored in [_elem_boundary_side_offsets[i], _elem_boundary_side_offsets[i+1]).
+   */
+  std::vector<unsigned int> _elem_boundary_side_offsets;
+
+  /// The (side, boundary id) pairs of all elements, ordered by element id and then by side
+  std::vector<std::pair<unsigned short int, BoundaryID> > _elem_boundary_sides;
+
   /// Whether or not this Mesh is allowed to read a recovery file
   bool _allow_recovery;
 };
@@ -0,0 +1,95 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef POINTLOCATIONCACHE_H
+#define POINTLOCATIONCACHE_H
+
+#include "Moose.h"
+
+// libMesh includes
+#include "libmesh/point.h"
+#include "libmesh/point_locator_base.h"
+
+#include <map>
+
+// libMesh forward declarations
+namespace libMesh
+{
+class Elem;
+}
+
+/**
+ * Remembers the element each point was located in, so that points that are looked up
+ * repeatedly (samplers, point postprocessors, point sources, ...) are only searched for once.
+ *
+ * The cached locations are only valid as long as the mesh does not change: the owner has to
+ * clear() the cache when the mesh is adapted or moved.  Points that are not looked up again
+ * (e.g. moving point sources) are dropped by dropUnusedLocations(), which the owner calls
+ * periodically to keep the size of the cache bounded.
+ */
+class PointLocationCache
+{
+public:
+  PointLocationCache();
+  virtual ~PointLocationCache();
+
+  /**
+   * Whether or not the cache has a point locator to look up new points with
+   */
+  bool initialized() const { return _point_locator.get() != NULL; }
+
+  /**
+   * Replace the point locator (the cache takes ownership of it) and forget all of the cached locations.
+   * @param point_locator The new point locator, may be NULL
+   */
+  void setPointLocator(PointLocatorBase * point_locator);
+
+  /**
+   * The point locator used to look up the points that are not cached yet
+   */
+  const PointLocatorBase & pointLocator() const;
+
+  /**
+   * Find the element containing a point.
+   * @param p The point in physical space
+   * @return The element found by the point locator, NULL if the point is not in the mesh
+   */
+  const Elem * locate(const Point & p);
+
+  /**
+   * Forget all of the cached locations, the point locator is kept
+   */
+  void clear();
+
+  /**
+   * Forget the cached locations of the points that were not looked up since the previous call
+   */
+  void dropUnusedLocations();
+
+  /// The number of cached locations
+  std::size_t size() const { return _locations.size() + _unused_locations.size(); }
+
+protected:
+  /// The point locator for the points that are not cached yet
+  UniquePtr<PointLocatorBase> _point_locator;
+
+  /// The element each point was found in (NULL when it was not found), since the last dropUnusedLocations()
+  std::map<Point, const Elem *> _locations;
+
+  /// The locations cached before the last dropUnusedLocations(), they are moved back to _locations when used
+  std::map<Point, const Elem *> _unused_locations;
+};
+
+#endif //POINTLOCATIONCACHE_H
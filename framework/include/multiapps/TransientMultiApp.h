@@ -28,6 +28,11 @@ InputParameters validParams<TransientMultiApp>();
  * MultiApp Implementation for Transient Apps.
  * In particular, this is important because TransientMultiApps
  * will be taken into account in the time step selection process.
+ *
+ * The apps owned by a processor are solved one after another: they share libMesh's global
+ * communicator (swapped in by solveStep()), PETSc, the perf logs and the console, none of
+ * which can be used from several threads at once.  The apps are solved concurrently by
+ * running on more processors, see MultiApp::buildComm().
  */
 class TransientMultiApp :
   public MultiApp
@@ -87,6 +92,13 @@ private:
    */
   void setupApp(unsigned int i, Real time = 0.0);
 
+  /**
+   * Print the wall time spent solving each of the local apps.
+   *
+   * @param app_solve_times The solve time of each local app, in seconds
+   */
+  void printSolveTimes(const std::vector<Real> & app_solve_times) const;
+
   std::vector<Transient *> _transient_executioners;
 
   bool _sub_cycling;
@@ -121,6 +133,9 @@ private:
   /// Flag for toggling console output on sub cycles
   bool _print_sub_cycles;
 
+  /// Whether or not to print the time spent solving the local apps
+  bool _print_solve_times;
+
 };
 
 #endif // TRANSIENTMULTIAPP_H
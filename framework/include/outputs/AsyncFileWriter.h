@@ -0,0 +1,155 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef ASYNCFILEWRITER_H
+#define ASYNCFILEWRITER_H
+
+#include "Moose.h"
+
+// libMesh includes
+#include "libmesh/threads.h"
+
+// System includes
+#include <string>
+#include <list>
+#include <vector>
+#include <pthread.h>
+
+/**
+ * Writes files on a dedicated background thread.
+ *
+ * The caller hands over a snapshot of the file contents and returns to the simulation
+ * right away, the file is written while the solve continues.  The jobs (writes, appends and
+ * removals) are processed in the order they were queued.  The queue is bounded: once it is
+ * full, queueing blocks until the writer catches up, which keeps the memory held by the
+ * snapshots in check.
+ *
+ * Only the calling thread may queue jobs, the writer itself never calls into MOOSE or libMesh.
+ * A file is written to "<file_name>.tmp" first and renamed once it is complete, so a crash
+ * never leaves a partially written file behind.  When libMesh is built without support for
+ * threads (Threads::Thread would not run concurrently) the jobs are done right away by the
+ * calling thread.
+ */
+class AsyncFileWriter
+{
+public:
+  /**
+   * @param max_queue_size The maximum number of jobs waiting to be processed
+   */
+  AsyncFileWriter(unsigned int max_queue_size);
+
+  /**
+   * Processes all of the remaining jobs before stopping the writer thread
+   */
+  virtual ~AsyncFileWriter();
+
+  /**
+   * Queue a write of a file.  The contents are taken over (swapped out) without copying
+   * them, so "contents" is empty on return.
+   * @param file_name The file to write
+   * @param contents The data to write to the file
+   * @param append When true the data is appended to the file instead of replacing it
+   */
+  void write(const std::string & file_name, std::string & contents, bool append = false);
+
+  /**
+   * Queue the removal of a file, it happens after all of the previously queued writes
+   */
+  void remove(const std::string & file_name);
+
+  /**
+   * Wait for all of the queued jobs to be done.  Reports an error for any file that
+   * could not be written and a warning for any file that could not be removed.
+   */
+  void flush();
+
+  /// The number of bytes written so far
+  std::size_t bytesWritten();
+
+  /// The time the writer thread has spent writing so far
+  Real writeSeconds();
+
+  /// The time the calling thread has spent waiting on the writer so far
+  Real waitSeconds();
+
+protected:
+  /// A single file operation
+  struct Job
+  {
+    std::string _file_name;
+    std::string _contents;
+    bool _append;
+    bool _remove;
+  };
+
+  /// Entry point of the writer thread
+  class Runner
+  {
+  public:
+    Runner(AsyncFileWriter & writer) : _writer(writer) {}
+    void operator()() { _writer.processJobs(); }
+
+  protected:
+    AsyncFileWriter & _writer;
+  };
+
+  /// Processes jobs until the writer is shut down
+  void processJobs();
+
+  /// Carry out one job, returns false if it failed
+  bool doJob(const Job & job);
+
+  /// Carry out one job and record its statistics, called with the mutex unlocked
+  void processJob(const Job & job);
+
+  /// Move a job into the queue (without copying its contents), blocking while the queue is full
+  void queueJob(Job & job);
+
+  /// The maximum number of jobs in the queue
+  unsigned int _max_queue_size;
+
+  /// The jobs that still have to be processed, oldest first
+  std::list<Job> _queue;
+
+  /// True while the writer is processing a job that was already taken off the queue
+  bool _busy;
+
+  /// Set when the writer thread has to stop once the queue is empty
+  bool _shutdown;
+
+  /// Files that could not be written
+  std::vector<std::string> _failed_files;
+
+  /// Files that could not be removed
+  std::vector<std::string> _failed_removals;
+
+  /// Statistics
+  std::size_t _bytes_written;
+  Real _write_seconds;
+  Real _wait_seconds;
+
+  /// The writer thread, NULL when the jobs are done by the calling thread
+  Threads::Thread * _thread;
+
+  /// libMesh's Threads do not provide condition variables, so the waits use pthreads directly
+  pthread_mutex_t _mutex;
+
+  /// Signaled when a job is queued or the writer is shut down
+  pthread_cond_t _job_queued;
+
+  /// Signaled when the writer takes a job off the queue or finishes one
+  pthread_cond_t _job_done;
+};
+
+#endif //ASYNCFILEWRITER_H
@@ -89,6 +89,12 @@ private:
   bool _set_delimiter;
   std::string _delimiter;
 
+  /// Flag for appending only the new rows to the file
+  bool _incremental;
+
+  /// Flag for keeping the rows that are already in the file in memory
+  bool _keep_history;
+
   /// Flag for writting scalar and/or postprocessor data
   bool _write_all_table;
 
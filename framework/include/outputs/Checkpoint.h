@@ -90,6 +90,14 @@ protected:
 
   void updateCheckpointFiles(CheckpointFileNames file_struct);
 
+  /**
+   * Print the total number of bytes written by all processors for a checkpoint and the time it took
+   * @param file_struct The files of the checkpoint
+   * @param n_bytes The number of bytes of restartable data and material properties written by this processor
+   * @param seconds The wall time this processor spent writing the checkpoint
+   */
+  void printWriteStats(const CheckpointFileNames & file_struct, std::size_t n_bytes, Real seconds);
+
 private:
 
   /// Max no. of output files to store
@@ -101,6 +109,12 @@ private:
   /// True if outputing checkpoint files in binary format
   bool _binary;
 
+  /// True if the restartable data and material properties of all processors go into one file
+  bool _shared_file;
+
+  /// True if the size and duration of each checkpoint is printed
+  bool _print_write_stats;
+
   /// Reference to the restartable data
   const RestartableDatas & _restartable_data;
 
@@ -25,6 +25,7 @@
 
 // Forward declarations
 class Checkpoint;
+class AsyncFileWriter;
 class FEProblem;
 
 /**
@@ -194,6 +195,24 @@ public:
    */
   std::ostringstream & consoleBuffer() { return _console_buffer; }
 
+  /**
+   * Start the background thread used for asynchronous file writes
+   * @param max_queue_size The number of writes that may be pending before outputs have to wait
+   */
+  void enableAsyncWriter(unsigned int max_queue_size);
+
+  /**
+   * The background file writer
+   * @return A pointer to the writer, NULL unless asynchronous output was requested
+   */
+  AsyncFileWriter * asyncWriter() { return _async_writer; }
+
+  /**
+   * Wait for all of the pending asynchronous writes to finish
+   * @param report When true the amount of writing that overlapped the simulation is printed
+   */
+  void flushAsyncWriter(bool report = false);
+
 private:
 
   /**
@@ -339,6 +358,9 @@ private:
   /// Flag indicating that next call to outputStep is forced
   bool _force_output;
 
+  /// The background writer for asynchronous output (NULL when disabled)
+  AsyncFileWriter * _async_writer;
+
   // Allow complete access:
   // FEProblem for calling initial, timestepSetup, outputStep, etc. methods
   friend class FEProblem;
@@ -40,6 +40,9 @@ public:
   void threadJoin(const UserObject & y);
 
 protected:
+  /// Registers the values gathered in getValue() with the fused reduction
+  virtual void registerReductions();
+
   Real _avg;
   unsigned int _n;
 };
@@ -46,6 +46,9 @@ public:
   virtual void threadJoin(const UserObject & y);
 
 protected:
+  /// Registers the values gathered in getValue() with the fused reduction
+  virtual void registerReductions();
+
   /// Get the extreme value at each quadrature point
   virtual void computeQpValue();
 
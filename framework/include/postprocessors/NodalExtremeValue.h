@@ -47,6 +47,9 @@ public:
   virtual void threadJoin(const UserObject & y);
 
 protected:
+  /// Registers the values gathered in getValue() with the fused reduction
+  virtual void registerReductions();
+
   /// The extreme value type ("min" or "max")
   ExtremeType _type;
 
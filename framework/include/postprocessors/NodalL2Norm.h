@@ -36,6 +36,9 @@ public:
   virtual void threadJoin(const UserObject & y);
 
 protected:
+  /// Registers the values gathered in getValue() with the fused reduction
+  virtual void registerReductions();
+
   Real _sum_of_squares;
 };
 
@@ -0,0 +1,52 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef NUMPENETRATIONSEARCHNODES_H
+#define NUMPENETRATIONSEARCHNODES_H
+
+#include "GeneralPostprocessor.h"
+
+//Forward Declarations
+class NumPenetrationSearchNodes;
+class PenetrationLocator;
+
+template<>
+InputParameters validParams<NumPenetrationSearchNodes>();
+
+/**
+ * Returns the number of slave nodes searched, or skipped, by the last penetration search
+ * between two boundaries, summed over the processors (see PenetrationLocator::numSearchedNodes(),
+ * PenetrationLocator::numSkippedNodes() and PenetrationLocator::numOffFaceSkippedNodes()).
+ */
+class NumPenetrationSearchNodes : public GeneralPostprocessor
+{
+public:
+  NumPenetrationSearchNodes(const std::string & name, InputParameters parameters);
+
+  virtual void initialize() {}
+  virtual void execute();
+
+  virtual Real getValue();
+
+protected:
+  PenetrationLocator & _penetration_locator;
+
+  /// Which of the slave nodes are counted: searched, skipped or off_face_skipped
+  MooseEnum _nodes;
+
+  Real _value;
+};
+
+#endif //NUMPENETRATIONSEARCHNODES_H
@@ -40,6 +40,9 @@ public:
   virtual void threadJoin(const UserObject & y);
 
 protected:
+  /// Registers the values gathered in getValue() with the fused reduction
+  virtual void registerReductions();
+
   virtual Real computeQpIntegral() = 0;
   virtual Real computeIntegral();
 
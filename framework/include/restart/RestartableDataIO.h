@@ -21,6 +21,7 @@
 #include <list>
 
 class RestartableDatas;
+class AsyncFileWriter;
 
 class FEProblem;
 
@@ -38,8 +39,13 @@ public:
 
   /**
    * Write out the restartable data.
+   * @param shared_file When true the data of all processors and threads is written to a single file
+   * named base_file_name instead of one file per processor and thread
+   * @param async_writer When given, the per-processor files are handed to this background writer
+   * @return The number of bytes written by this processor
    */
-  void writeRestartableData(std::string base_file_name, const RestartableDatas & restartable_datas, std::set<std::string> & _recoverable_data);
+  std::size_t writeRestartableData(std::string base_file_name, const RestartableDatas & restartable_datas, std::set<std::string> & _recoverable_data,
+                                   bool shared_file = false, AsyncFileWriter * async_writer = NULL);
 
   /**
    * Read restartable data header to verify that we are restarting on the correct number of processors and threads.
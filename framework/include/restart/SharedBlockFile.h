@@ -0,0 +1,119 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef SHAREDBLOCKFILE_H
+#define SHAREDBLOCKFILE_H
+
+#include "Moose.h"
+
+// libMesh includes
+#include "libmesh/parallel.h"
+
+// System includes
+#include <string>
+#include <vector>
+#include <iostream>
+#include <fstream>
+
+/**
+ * A stream buffer that throws away everything written to it and only counts the bytes.
+ * Used to find the size of serialized data without building a copy of it in memory.
+ */
+class CountingStreamBuf : public std::streambuf
+{
+public:
+  CountingStreamBuf() : _count(0) {}
+
+  /// The number of bytes written so far
+  std::size_t count() const { return _count; }
+
+protected:
+  virtual std::streamsize xsputn(const char * /*s*/, std::streamsize n)
+  {
+    _count += n;
+    return n;
+  }
+
+  virtual int_type overflow(int_type c)
+  {
+    if (!traits_type::eq_int_type(c, traits_type::eof()))
+      ++_count;
+    return traits_type::not_eof(c);
+  }
+
+  /// Only supports tellp()
+  virtual pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode /*which*/)
+  {
+    if (off == 0 && dir == std::ios_base::cur)
+      return pos_type(_count);
+    return pos_type(off_type(-1));
+  }
+
+  std::size_t _count;
+};
+
+/**
+ * Reads and writes a single file shared by all the processors of a communicator.
+ *
+ * Every processor contributes the same number of blocks.  The sizes of all blocks are
+ * exchanged up front, processor 0 writes a header holding the offset of every block and
+ * then each processor writes its own blocks directly into its region of the file.  Blocks
+ * are ordered by processor, so block b of processor p is global block p * n_local_blocks + b.
+ *
+ * File layout: 4 byte id, number of blocks, offset of each block, the blocks.
+ */
+class SharedBlockFile
+{
+public:
+  /**
+   * Interface for the objects that produce the blocks of a shared file.
+   * writeBlock() must produce exactly blockSize() bytes.
+   */
+  class BlockWriter
+  {
+  public:
+    virtual ~BlockWriter() {}
+
+    /// The number of blocks written by this processor
+    virtual unsigned int numBlocks() const = 0;
+
+    /// Write local block "block" to the stream
+    virtual void writeBlock(std::ostream & out, unsigned int block) = 0;
+
+    /// The size of local block "block" in bytes, by default found by writing the block to a CountingStreamBuf
+    virtual std::size_t blockSize(unsigned int block);
+  };
+
+  /**
+   * Collectively write the blocks of all processors into a single file.
+   * @return The number of bytes written by this processor
+   */
+  static std::size_t write(const Parallel::Communicator & comm, const std::string & file_name, BlockWriter & writer);
+
+  /**
+   * Whether or not file_name exists and is a shared block file
+   */
+  static bool isSharedFile(const std::string & file_name);
+
+  /**
+   * Open a shared block file and position the stream at the start of the given global block.
+   */
+  static void openBlock(const std::string & file_name, unsigned int block, std::ifstream & in);
+
+protected:
+  /// The 4 byte id at the start of every shared block file
+  static const char file_id[4];
+};
+
+#endif //SHAREDBLOCKFILE_H
@@ -16,6 +16,7 @@
 #define MULTIAPPNEARESTNODETRANSFER_H
 
 #include "MultiAppTransfer.h"
+#include "KDTree.h"
 
 class MooseVariable;
 class MultiAppNearestNodeTransfer;
@@ -42,14 +43,52 @@ protected:
   virtual void transferFromMultiApp();
 
   /**
-   * Return the nearest node to the point p.
+   * A spatial index over the candidate source nodes of one source mesh.
+   */
+  struct SourceNodeTree
+  {
+    /// The candidate nodes, in the order they were handed to _tree
+    std::vector<Node *> _nodes;
+
+    /// Index over the positions of _nodes
+    KDTree _tree;
+
+    /// Whether or not _tree has been built
+    bool _built;
+
+    SourceNodeTree() : _built(false) {}
+  };
+
+  /**
+   * Get the spatial index for a source mesh, building or refitting it as needed.
+   * @param source_id Identifies the source mesh: the global app number, or
+   *                  libMesh::invalid_uint for the master mesh
+   * @param mesh The mesh in which we search for nodes
+   * @param local true if we look at local nodes, otherwise we look at all nodes
+   */
+  const SourceNodeTree & getSourceNodeTree(unsigned int source_id, MooseMesh * mesh, bool local);
+
+  /**
+   * Return the nearest node to the point p, using (and filling) the node
+   * and distance caches when the meshes are fixed.
    * @param p The point you want to find the nearest node to.
    * @param distance This will hold the distance between the returned node and p
-   * @param mesh The mesh in which we search for the node
-   * @param local true if we look at local nodes, otherwise we look at all nodes
+   * @param key The (source id, target node or element id) pair identifying this search
+   * @param source_tree The index of the nodes we search
    * @return The Node closest to point p.
    */
-  Node * getNearestNode(const Point & p, Real & distance, MooseMesh * mesh, bool local);
+  Node * getCachedNearestNode(const Point & p, Real & distance,
+                              const std::pair<unsigned int, dof_id_type> & key,
+                              const SourceNodeTree & source_tree);
+
+  /**
+   * Return the nearest node to the point p.
+   * @param p The point you want to find the nearest node to.
+   * @param distance This will hold the distance between the returned node and p
+   * @param source_tree The index of the nodes we search
+   * @return The Node closest to point p, or NULL if there are no candidate nodes.
+   */
+  Node * getNearestNode(const Point & p, Real & distance, const SourceNodeTree & source_tree);
 
   AuxVariableName _to_var_name;
   VariableName _from_var_name;
@@ -60,11 +99,14 @@ protected:
   /// If true then node connections will be cached
   bool _fixed_meshes;
 
-  /// Used to cache nodes
-  std::map<dof_id_type, Node *> _node_map;
+  /// Used to cache nodes, indexed by (source id, target node or element id)
+  std::map<std::pair<unsigned int, dof_id_type>, Node *> _node_map;
+
+  /// Used to cache distances, indexed by (source id, target node or element id)
+  std::map<std::pair<unsigned int, dof_id_type>, Real> _distance_map;
 
-  /// Used to cache distances
-  std::map<dof_id_type, Real> _distance_map;
+  /// Spatial indices of the source meshes, indexed by source id
+  std::map<unsigned int, SourceNodeTree> _source_trees;
 };
 
 #endif /* MULTIAPPVARIABLEVALUESAMPLEPOSTPROCESSORTRANSFER_H */
@@ -29,6 +29,10 @@ InputParameters validParams<LayeredBase>();
 
 /**
  * This UserObject computes volume integrals of a variable storing partial sums for the specified number of intervals in a direction (x,y,z).c
+ *
+ * The layers can optionally be split radially as well, into rings around an axis parallel to the
+ * direction.  The layers are then numbered radial_layer * _num_axial_layers + axial_layer and the
+ * sampling only looks for neighboring values along the axis within the same ring.
  */
 class LayeredBase
 {
@@ -74,6 +78,21 @@ protected:
    */
   bool layerHasValue(unsigned int layer) const { return _layer_has_value[layer]; }
 
+  /**
+   * The layer along the direction a coordinate falls in
+   */
+  unsigned int getAxialLayer(Real direction_x) const;
+
+  /**
+   * The radial layer a point falls in
+   */
+  unsigned int getRadialLayer(const Point & p) const;
+
+  /**
+   * Rebuild the nearest populated layers, must be called whenever the layers that have a value change
+   */
+  void updateNearestLayers();
+
   /// Name of this object
   std::string _layered_base_name;
 
@@ -92,9 +111,27 @@ protected:
   /// Number of layers to split the mesh into
   unsigned int _num_layers;
 
+  /// Number of layers along the direction
+  unsigned int _num_axial_layers;
+
   /// The boundaries of the layers
   std::vector<Real> _layer_bounds;
 
+  /// Number of radial layers, 1 when the layers are not split radially
+  unsigned int _num_radial_layers;
+
+  /// Whether or not the radial layers are equally spaced intervals or "radial_bounds"
+  bool _radial_interval_based;
+
+  /// The boundaries of the radial layers
+  std::vector<Real> _radial_bounds;
+
+  /// A point on the axis of the radial layers
+  Point _radial_center;
+
+  /// The largest distance of the mesh from the axis of the radial layers
+  Real _radial_max;
+
   /// How to sample the values
   unsigned int _sample_type;
 
@@ -110,6 +147,22 @@ private:
   /// Whether or not each layer has had any value summed into it
   std::vector<bool> _layer_has_value;
 
+  /// The closest layers in the same ring that have a value, looked up instead of searched for by integralValue()
+  struct NearestLayers
+  {
+    /// The first layer at or above this one with a value, -1 if there is none
+    int _higher;
+
+    /// The first layer below this one with a value, -1 if there is none
+    int _lower;
+
+    /// The coordinate the interpolation starts from: the top of the lower layer, or the bottom of the mesh
+    Real _lower_coor;
+  };
+
+  /// The nearest populated layers of each layer, rebuilt by initialize() and finalize()
+  std::vector<NearestLayers> _nearest_layers;
+
   /// Subproblem for the child object
   SubProblem & _layered_base_subproblem;
 };
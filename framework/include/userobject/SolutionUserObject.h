@@ -25,6 +25,7 @@ namespace libMesh
   class EquationSystems;
   class System;
   class MeshFunction;
+  class PointLocatorBase;
   template<class T> class NumericVector;
 }
 
@@ -57,6 +58,25 @@ public:
    */
   virtual Real pointValue(Real t, const Point & p, const std::string & var_name) const;
 
+  /**
+   * Returns a value at a specific location and variable, for use by objects that evaluate
+   * the solution repeatedly (see SolutionAux).  When 'cache_points' is enabled the element
+   * containing the point and the values of all the variables there are remembered, so
+   * evaluating the same point again (or another variable at that point) skips the point location.
+   * @param t The time at which to extract (not used, it is handled automatically when reading the data)
+   * @param p The location at which to return a value
+   * @param local_var_index The index of the variable, see getLocalVarIndex()
+   * @param tid The thread calling this method, each thread has its own cache
+   * @return The desired value for the given variable at a location
+   */
+  Real pointValue(Real t, const Point & p, unsigned int local_var_index, THREAD_ID tid) const;
+
+  /**
+   * Returns the local index of a variable, for use with pointValue()
+   * @param var_name The variable name
+   */
+  unsigned int getLocalVarIndex(const std::string & var_name) const;
+
   /**
    * Return a value directly from a Node
    * @param node A pointer to the node at which a value is desired
@@ -85,6 +105,9 @@ public:
   /// Initialize the System and Mesh objects for the solution being read
   virtual void initialSetup();
 
+  /// Clears the cached points, the points evaluated on the new mesh are likely different
+  virtual void meshChanged();
+
 
   const std::vector<std::string> & variableNames() const;
 
@@ -140,6 +163,46 @@ protected:
    */
   Real evalMeshFunction(const Point & p, std::string var_name, unsigned int func_num) const;
 
+  /**
+   * Applies the coordinate transformations to a point in the simulation
+   * @param p The location in the simulation
+   * @return The location in the mesh that was read
+   */
+  Point transformPoint(const Point & p) const;
+
+  /// The located element and the values of all the variables at a cached point
+  struct CachedPoint
+  {
+    /// The element containing the point (in _mesh)
+    const Elem * _elem;
+
+    /// The reference coordinates of the point in _elem
+    Point _ref_point;
+
+    /// The value of _solution_serial_number when the values were computed
+    unsigned int _serial_number;
+
+    /// The values of the variables (in _local_variable_index order) for both solutions
+    std::vector<Real> _values;
+    std::vector<Real> _values2;
+  };
+
+  /**
+   * Returns the cached values at a (transformed) point, locating it and computing
+   * the values of all the variables at once when needed
+   * @param pt The location in the mesh that was read
+   * @param tid The thread id
+   */
+  const CachedPoint & cachedPoint(const Point & pt, THREAD_ID tid) const;
+
+  /**
+   * Computes the values of all the variables at a located point
+   * @param solution The solution to evaluate
+   * @param cached_point The located point
+   * @param values The values of the variables, in _local_variable_index order
+   */
+  void evalCachedPoint(const NumericVector<Number> & solution, const CachedPoint & cached_point, std::vector<Real> & values) const;
+
   /// File type to read (0 = xda; 1 = ExodusII)
   MooseEnum _file_type;
 
@@ -244,6 +307,21 @@ protected:
 
   /// True if initial_setup has executed
   bool _initialized;
+
+  /// Flag for caching the point locations and values (see pointValue())
+  const bool _cache_points;
+
+  /// The variable numbers in _system, in _local_variable_index order
+  std::vector<unsigned int> _var_nums;
+
+  /// Incremented every time the solutions are read, invalidates the cached values
+  unsigned int _solution_serial_number;
+
+  /// The point locators used for the cached points (one per thread)
+  std::vector<PointLocatorBase *> _point_locators;
+
+  /// The cached points, keyed on the transformed location (one map per thread)
+  mutable std::vector<std::map<Point, CachedPoint> > _cached_points;
 };
 
 #endif //SOLUTIONUSEROBJECT_H
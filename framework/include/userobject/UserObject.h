@@ -24,6 +24,7 @@
 #include "Restartable.h"
 #include "MooseMesh.h"
 #include "MeshChangedInterface.h"
+#include "ParallelReduction.h"
 
 //libMesh includes
 #include "libmesh/libmesh_common.h"
@@ -92,30 +93,98 @@ public:
   template <typename T>
   void gatherSum(T & value)
   {
+    // Already reduced along with the values of the other user objects
+    if (_reduced_values.find(&value) != _reduced_values.end())
+      return;
+
+    Moose::perf_log.push("gather_sum()", "Parallel Reductions");
     _communicator.sum(value);
+    Moose::perf_log.pop("gather_sum()", "Parallel Reductions");
   }
 
   template <typename T>
   void gatherMax(T & value)
   {
+    if (_reduced_values.find(&value) != _reduced_values.end())
+      return;
+
+    Moose::perf_log.push("gather_max()", "Parallel Reductions");
     _communicator.max(value);
+    Moose::perf_log.pop("gather_max()", "Parallel Reductions");
   }
 
   template <typename T>
   void gatherMin(T & value)
   {
+    if (_reduced_values.find(&value) != _reduced_values.end())
+      return;
+
+    Moose::perf_log.push("gather_min()", "Parallel Reductions");
     _communicator.min(value);
+    Moose::perf_log.pop("gather_min()", "Parallel Reductions");
   }
 
   template <typename T1, typename T2>
   void gatherProxyValueMax(T1 & value, T2 & proxy)
   {
+    Moose::perf_log.push("gather_proxy_max()", "Parallel Reductions");
     unsigned int rank;
     _communicator.maxloc(value, rank);
     _communicator.broadcast(proxy, rank);
+    Moose::perf_log.pop("gather_proxy_max()", "Parallel Reductions");
   }
 
+  /**
+   * Adds the values this object gathers to a fused reduction, see registerReductions().
+   * This is called by the framework after threadJoin() and before finalize().
+   */
+  void addReductions(ParallelReduction & reduction);
+
+  /**
+   * Called by the framework once the object is finalized, the gathers are performed
+   * by the object again afterwards.
+   */
+  void clearReductions();
+
 protected:
+  /**
+   * Objects override this to register the values they gather in finalize() (or getValue())
+   * with reduceSum(), reduceMax() and reduceMin().  The framework reduces the values of all of
+   * the user objects computed together at once before finalizing them, and the gatherSum(),
+   * gatherMax() and gatherMin() calls on the registered values are then skipped.
+   */
+  virtual void registerReductions() {}
+
+  /**
+   * Register a value for the fused parallel sum, only to be called from registerReductions()
+   */
+  template <typename T>
+  void reduceSum(T & value)
+  {
+    _parallel_reduction->sum(value);
+    _reduced_values.insert(&value);
+  }
+
+  /**
+   * Register a value for the fused parallel maximum, only to be called from registerReductions()
+   */
+  template <typename T>
+  void reduceMax(T & value)
+  {
+    _parallel_reduction->max(value);
+    _reduced_values.insert(&value);
+  }
+
+  /**
+   * Register a value for the fused parallel minimum, only to be called from registerReductions()
+   */
+  template <typename T>
+  void reduceMin(T & value)
+  {
+    _parallel_reduction->min(value);
+    _reduced_values.insert(&value);
+  }
+
   /// Reference to the Subproblem for this user object
   SubProblem & _subproblem;
 
@@ -128,6 +197,13 @@ protected:
 
   /// Coordinate system
   const Moose::CoordinateSystemType & _coord_sys;
+
+private:
+  /// The fused reduction the values are registered with, only set during addReductions()
+  ParallelReduction * _parallel_reduction;
+
+  /// The values that were reduced by the fused reduction
+  std::set<const void *> _reduced_values;
 };
 
 
@@ -88,6 +88,18 @@ public:
    */
   void printCSV(const std::string & file_name, int interval=1, bool align = false);
 
+  /**
+   * Method for writing the table to a csv file incrementally.  Only the rows added since the
+   * last call (and the last row written, in case it was updated) are appended to the file; the
+   * header and all of the rows are rewritten only when a new column appears.
+   *
+   * When keep_history is false the rows that are already in the file are dropped from memory,
+   * they are read back from the file when a rewrite is needed.
+   *
+   * Note: Only call this on processor 0!
+   */
+  void appendCSV(const std::string & file_name, bool keep_history = true);
+
   void printEnsight(const std::string & file_name);
   void writeExodus(ExodusII_IO * ex_out, Real time);
   void makeGnuplot(const std::string & base_file, const std::string & format);
@@ -119,6 +131,16 @@ protected:
                       std::set<std::string>::iterator & col_begin, std::set<std::string>::iterator & col_end) const;
 
 
+  /// Write a single row of the csv file
+  void printCSVRow(std::map<Real, std::map<std::string, Real> >::iterator & row, bool align,
+                   std::map<std::string, unsigned int> & width);
+
+  /// Read the rows of an existing csv file that are older than anything in memory back into the table
+  void loadCSVRows(const std::string & file_name);
+
+  /// Shrink the csv file if it used to extend past the current end
+  void truncateCSV(std::streampos old_end_pos);
+
   /**
    * Returns the width of the terminal using sys/ioctl
    */
@@ -159,6 +181,24 @@ private:
   /// *.csv file precision, defaults to 14
   unsigned int _csv_precision;
 
+  /// Whether or not the csv file is in a state that appendCSV() can extend
+  bool _csv_append_valid;
+
+  /// The number of columns in the csv file header
+  unsigned int _csv_n_columns_written;
+
+  /// The key of the last row written to the csv file
+  Real _csv_last_written_key;
+
+  /// The position in the csv file where the last row starts
+  std::streampos _csv_last_row_pos;
+
+  /// The position of the end of the csv file
+  std::streampos _csv_end_pos;
+
+  /// Whether the csv file holds rows that are not in memory
+  bool _csv_load_existing;
+
   friend void dataStore<FormattedTable>(std::ostream & stream, FormattedTable & table, void * context);
   friend void dataLoad<FormattedTable>(std::istream & stream, FormattedTable & v, void * context);
 };
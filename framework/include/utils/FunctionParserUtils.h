@@ -17,6 +17,9 @@
 
 #include "InputParameters.h"
 
+// libMesh includes
+#include "libmesh/fparser_ad.hh"
+
 // Forward declartions
 class FunctionParserUtils;
 
@@ -31,7 +34,20 @@ public:
   /// Shorthand for an autodiff function parser object.
   typedef FunctionParserADBase<Real> ADFunction;
 
+  /**
+   * Optimize and just-in-time compile a parsed function (as selected by the flags), falling
+   * back to the byte code interpreter if the compilation fails.  This is the common path for
+   * all of the parsed objects, including the ones not deriving from FunctionParserUtils.
+   * @param parser The parsed function
+   * @param optimize Whether to run the algebraic optimizer
+   * @param jit Whether to just-in-time compile the function
+   */
+  static void optimizeFunction(ADFunction * parser, bool optimize, bool jit);
+
 protected:
+  /// Optimize and just-in-time compile a parsed function according to the feature flags
+  void optimizeFunction(ADFunction * parser);
+
   /// Evaluate FParser object and check EvalError
   Real evaluate(ADFunction *);
 
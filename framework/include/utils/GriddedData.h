@@ -44,6 +44,18 @@ public:
    */
   GriddedData(std::string file_name);
 
+  /**
+   * Construct with a file name, using a binary cache of the parsed data.
+   * If binary_cache exists and was written from file_name as it is now (same size and
+   * modification time) the data is read from it instead of parsing file_name.  Otherwise file_name is parsed and, if write_cache
+   * is true, the binary cache is written for the next time.
+   * @param file_name The data file
+   * @param binary_cache The binary cache file
+   * @param write_cache Whether to (re)write the binary cache if it is out of date,
+   *                    only one process should do so.
+   */
+  GriddedData(std::string file_name, std::string binary_cache, bool write_cache);
+
   virtual ~GriddedData()
     {}
 
@@ -81,9 +93,26 @@ public:
    */
   Real evaluateFcn(const std::vector<unsigned int> & ijk);
 
+  /**
+   * Writes the grid and function values to a binary file, which
+   * is much faster to read back than the text data file
+   */
+  void writeBinary(const std::string & file_name);
+
+  /**
+   * Whether or not the data was read from the binary cache instead of the data file
+   */
+  bool readFromCache() const { return _read_from_cache; }
+
 
 private:
 
+  bool _read_from_cache;
+
+  /// The size and modification time of the data file, stored in the binary cache to detect stale caches
+  long _data_file_size;
+  long _data_file_mtime;
+
   unsigned int _dim;
   std::vector<int> _axes;
   std::vector<std::vector<Real> > _grid;
@@ -91,6 +120,7 @@ private:
   std::vector<unsigned int> _step;
 
   void parse(unsigned int & dim, std::vector<int> & axes, std::vector<std::vector<Real> > & grid, std::vector<Real> & f, std::vector<unsigned int> & step, std::string file_name);
+  bool readBinary(const std::string & file_name);
   bool getSignificantLine(std::ifstream & file_stream, std::string & line);
   void splitToRealVec(const std::string & input_string, std::vector<Real> & output_vec);
 };
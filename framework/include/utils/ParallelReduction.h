@@ -0,0 +1,96 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef PARALLELREDUCTION_H
+#define PARALLELREDUCTION_H
+
+#include "Moose.h"
+
+// libMesh includes
+#include "libmesh/parallel.h"
+
+/**
+ * Packs many small parallel reductions into a single one per operation.
+ *
+ * The values are registered with sum(), max() and min(), reduce() then performs (at most)
+ * one sum, one max and one min over all of the processors and writes the results back into
+ * the registered values.  Integers are reduced as Reals, which is exact for the counts
+ * the user objects gather.
+ */
+class ParallelReduction
+{
+public:
+  ParallelReduction(const Parallel::Communicator & comm);
+
+  /// Register a value for the parallel sum
+  template <typename T>
+  void sum(T & value) { _sum_values.push_back(Value(value)); }
+
+  /// Register a value for the parallel maximum
+  template <typename T>
+  void max(T & value) { _max_values.push_back(Value(value)); }
+
+  /// Register a value for the parallel minimum
+  template <typename T>
+  void min(T & value) { _min_values.push_back(Value(value)); }
+
+  /**
+   * Performs the reductions of all the registered values, the registrations are cleared
+   */
+  void reduce();
+
+protected:
+  /// A registered value, only one of the pointers is set
+  class Value
+  {
+  public:
+    Value(Real & value) : _real(&value), _int(NULL), _unsigned(NULL) {}
+    Value(int & value) : _real(NULL), _int(&value), _unsigned(NULL) {}
+    Value(unsigned int & value) : _real(NULL), _int(NULL), _unsigned(&value) {}
+
+    Real get() const;
+    void set(Real value) const;
+
+  protected:
+    Real * _real;
+    int * _int;
+    unsigned int * _unsigned;
+  };
+
+  /// The reduction operations
+  enum Operation
+  {
+    SUM,
+    MAX,
+    MIN
+  };
+
+  /**
+   * Packs the values, reduces them with the given operation and unpacks the results
+   * @param values The registered values, cleared on return
+   * @param op The operation
+   */
+  void reduce(std::vector<Value> & values, Operation op);
+
+  /// The communicator to reduce over
+  const Parallel::Communicator & _communicator;
+
+  /// The registered values
+  std::vector<Value> _sum_values;
+  std::vector<Value> _max_values;
+  std::vector<Value> _min_values;
+};
+
+#endif //PARALLELREDUCTION_H
@@ -21,6 +21,7 @@
 
 //Forward Declarations
 class PointSamplerBase;
+class PointLocationCache;
 
 // libMesh Forward Declarations
 namespace libMesh
@@ -53,7 +54,7 @@ public:
 protected:
 
   /**
-   * Find the local element that contains the point.  This will attempt to use a cached element to speed things up.
+   * Find the local element that contains the point.  This uses the element the point was cached in, if the mesh has not changed since.
    *
    * @param p The point in physical space
    * @param id A unique ID for this point.
@@ -86,7 +87,8 @@ protected:
   /// So we don't have to create and destroy this
   std::vector<Point> _point_vec;
 
-  UniquePtr<PointLocatorBase> _pl;
+  /// The cached locations of the points on the mesh
+  PointLocationCache * _point_locations;
 };
 
 #endif
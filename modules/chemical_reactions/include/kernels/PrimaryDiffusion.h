@@ -54,6 +54,9 @@ protected:
   virtual Real computeQpJacobian();
   virtual Real computeQpOffDiagJacobian(unsigned int jvar);
 
+  /// The qp methods are overridden, so the batched Diffusion loops do not apply
+  virtual bool useBatchedLoops() const { return false; }
+
   /// Material property of dispersion-diffusion coefficient.
   const MaterialProperty<Real> & _diffusivity;
 };
@@ -55,6 +55,9 @@ protected:
   virtual Real computeQpJacobian();
   virtual Real computeQpOffDiagJacobian(unsigned int jvar);
 
+  /// The qp methods are overridden, so the batched TimeDerivative loops do not apply
+  virtual bool useBatchedLoops() const { return false; }
+
   /// Material property of porosity
   const MaterialProperty<Real> & _porosity;
 };
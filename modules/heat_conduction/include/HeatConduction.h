@@ -33,6 +33,9 @@ protected:
 
   virtual Real computeQpJacobian();
 
+  /// The qp methods are overridden, so the batched Diffusion loops do not apply
+  virtual bool useBatchedLoops() const { return false; }
+
 private:
   const unsigned _dim;
   const MaterialProperty<Real> & _diffusion_coefficient;
@@ -51,6 +51,9 @@ protected:
    */
   virtual Real computeQpJacobian();
 
+  /// The qp methods are overridden, so the batched TimeDerivative loops do not apply
+  virtual bool useBatchedLoops() const { return false; }
+
   /**
    * Setup the material property for the correct formulation of the equation
    */
@@ -32,6 +32,9 @@ protected:
   virtual Real computeQpResidual();
   virtual Real computeQpJacobian();
 
+  /// The qp methods are overridden, so the batched TimeDerivative loops do not apply
+  virtual bool useBatchedLoops() const { return false; }
+
   /**
    * This MooseArray will hold the reference we need to our
    * material property from the Material class
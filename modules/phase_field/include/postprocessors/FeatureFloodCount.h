@@ -67,18 +67,45 @@ protected:
   class BubbleData
   {
   public:
-    BubbleData(std::set<dof_id_type> & entity_ids, unsigned int var_idx) :
-        _entity_ids(entity_ids),
+    BubbleData(std::vector<dof_id_type> & entity_ids, unsigned int var_idx) :
         _var_idx(var_idx),
         _intersects_boundary(false)
-    {}
+    {
+      // Steal the ids instead of copying them, the caller is done with them
+      _entity_ids.swap(entity_ids);
+    }
 
-    std::set<dof_id_type> _entity_ids;
-    std::set<dof_id_type> _periodic_nodes;
+    /// The (sorted, unique) ids of the entities making up this bubble
+    std::vector<dof_id_type> _entity_ids;
+    /// The (sorted, unique) ids of the periodic nodes touched by this bubble
+    std::vector<dof_id_type> _periodic_nodes;
     unsigned int _var_idx;
     bool _intersects_boundary;
   };
 
+  /// A single id stored in a bubble, used to find overlapping bubbles by sorting
+  struct BubbleIdEntry
+  {
+    BubbleIdEntry(unsigned int var_idx, dof_id_type id, unsigned int bubble) :
+        _var_idx(var_idx),
+        _id(id),
+        _bubble(bubble)
+    {}
+
+    bool operator<(const BubbleIdEntry & rhs) const
+    {
+      if (_var_idx != rhs._var_idx)
+        return _var_idx < rhs._var_idx;
+      if (_id != rhs._id)
+        return _id < rhs._id;
+      return _bubble < rhs._bubble;
+    }
+
+    unsigned int _var_idx;
+    dof_id_type _id;
+    unsigned int _bubble;
+  };
+
   /**
    * This method is used to populate any of the data structures used for storing field data (nodal or elemental).
    * It is called at the end of finalize and can make use of any of the data structures created during
@@ -88,10 +115,17 @@ protected:
 
   /**
    * This method will "mark" all entities on neighboring elements that
-   * are above the supplied threshold
+   * are above the supplied threshold.  The flood is driven by an explicit stack rather
+   * than recursion so that large regions can't overflow the call stack.
    */
   void flood(const DofObject *dof_object, int current_idx, unsigned int live_region);
 
+  /**
+   * Visit a single entity during the flood: mark it if it belongs to a region and push its
+   * unvisited neighbors onto the flood stack.
+   */
+  void floodEntity(const DofObject *dof_object, int current_idx, unsigned int live_region);
+
   /**
    * These routines packs/unpack the _bubble_map data into a structure suitable for parallel
    * communication operations. See the comments in these routines for the exact
@@ -102,10 +136,23 @@ protected:
 
   /**
    * This routine merges the data in _bubble_sets from separate threads/processes to resolve
-   * any bubbles that were counted as unique by multiple processors.
+   * any bubbles that were counted as unique by multiple processors.  Bubbles owned by the same
+   * variable that share an entity (or a periodic node) are joined with a union-find structure, so
+   * the cost is dominated by a sort of all of the stored ids rather than by pairwise comparisons.
    */
   void mergeSets(bool use_periodic_boundary_info);
 
+  /**
+   * Union the groups (stored in parents) of any two bubbles with the same variable index that share
+   * an entity id, or a periodic node when use_periodic_nodes is true.  The root of each group is
+   * always its highest numbered bubble.
+   */
+  void joinOverlappingBubbles(const std::vector<std::list<BubbleData>::iterator> & bubbles, bool use_periodic_nodes,
+                              std::vector<unsigned int> & parents) const;
+
+  /// Returns the root of the group containing bubble, compressing the path along the way
+  static unsigned int findRoot(std::vector<unsigned int> & parents, unsigned int bubble);
+
   /**
    * This routine broadcasts a std::list<BubbleData> to other ranks. It includes both the
    * serialization and de-serialization routines.
@@ -236,6 +283,9 @@ protected:
   /// The data structure used to marshall the data between processes and/or threads
   std::vector<unsigned int> _packed_data;
 
+  /// The pending (entity, live region) pairs of the flood currently in progress
+  std::vector<std::pair<const DofObject *, unsigned int> > _flood_stack;
+
   /// The data structure used to find neighboring elements give a node ID
   std::vector< std::vector< const Elem * > > _nodes_to_elem_map;
 
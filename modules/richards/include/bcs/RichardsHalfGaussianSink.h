@@ -11,6 +11,7 @@
 
 #include "IntegratedBC.h"
 #include "RichardsVarNames.h"
+#include "RichardsFixedVector.h"
 
 // Forward Declarations
 class RichardsHalfGaussianSink;
@@ -66,10 +67,10 @@ protected:
   unsigned int _pvar;
 
   /// porepressure (or porepressure vector for multiphase problems)
-  const MaterialProperty<std::vector<Real> > & _pp;
+  const MaterialProperty<RichardsFixed<Real>::Vector> & _pp;
 
   /// d(porepressure_i)/dvariable_j
-  const MaterialProperty<std::vector<std::vector<Real> > > & _dpp_dv;
+  const MaterialProperty<RichardsFixed<Real>::Matrix> & _dpp_dv;
 };
 
 #endif //RICHARDSHALFGAUSSIANSINK
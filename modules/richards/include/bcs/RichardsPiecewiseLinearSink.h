@@ -16,6 +16,7 @@
 #include "RichardsDensity.h"
 #include "RichardsRelPerm.h"
 #include "RichardsSeff.h"
+#include "RichardsFixedVector.h"
 
 
 // Forward Declarations
@@ -105,7 +106,7 @@ protected:
    * d(_nodal_density)/d(variable_ph)  (variable_ph is the variable for phase=ph)
    * These are used in the jacobian calculations if _fully_upwind = true
    */
-  std::vector<std::vector<Real> > _dnodal_density_dv;
+  std::vector<RichardsFixed<Real>::Vector> _dnodal_density_dv;
 
   /**
    * nodal values of relative permeability
@@ -117,16 +118,19 @@ protected:
    * d(_nodal_relperm)/d(variable_ph)  (variable_ph is the variable for phase=ph)
    * These are used in the jacobian calculations if _fully_upwind = true
    */
-  std::vector<std::vector<Real> > _dnodal_relperm_dv;
+  std::vector<RichardsFixed<Real>::Vector> _dnodal_relperm_dv;
+
+  /// d(seff)/d(variable_ph) at a node, kept between elements to avoid allocating it each time
+  std::vector<Real> _dseff_dp;
 
   /// porepressure values (only the _pvar component is used)
-  const MaterialProperty<std::vector<Real> > & _pp;
+  const MaterialProperty<RichardsFixed<Real>::Vector> & _pp;
 
   /// d(porepressure_i)/d(variable_j)
-  const MaterialProperty<std::vector<std::vector<Real> > > & _dpp_dv;
+  const MaterialProperty<RichardsFixed<Real>::Matrix> & _dpp_dv;
 
   /// viscosity (only the _pvar component is used)
-  const MaterialProperty<std::vector<Real> > & _viscosity;
+  const MaterialProperty<RichardsFixed<Real>::Vector> & _viscosity;
 
   /// permeability
   const MaterialProperty<RealTensorValue> & _permeability;
@@ -135,19 +139,19 @@ protected:
    * derivative of effective saturation wrt variables
    * only _dseff_dv[_pvar][i] is used for i being all variables
    */
-  const MaterialProperty<std::vector<std::vector<Real> > > & _dseff_dv;
+  const MaterialProperty<RichardsFixed<Real>::Matrix> & _dseff_dv;
 
   /// relative permeability (only the _pvar component is used)
-  const MaterialProperty<std::vector<Real> > & _rel_perm;
+  const MaterialProperty<RichardsFixed<Real>::Vector> & _rel_perm;
 
   /// d(relperm_i)/d(variable_j)
-  const MaterialProperty<std::vector<std::vector<Real> > > & _drel_perm_dv;
+  const MaterialProperty<RichardsFixed<Real>::Matrix> & _drel_perm_dv;
 
   /// fluid density (only the _pvar component is used)
-  const MaterialProperty<std::vector<Real> > & _density;
+  const MaterialProperty<RichardsFixed<Real>::Vector> & _density;
 
   /// d(density_i)/d(variable_j)
-  const MaterialProperty<std::vector<std::vector<Real> > > & _ddensity_dv;
+  const MaterialProperty<RichardsFixed<Real>::Matrix> & _ddensity_dv;
 
   /**
    * Holds the values of pressures at all the nodes of the element
@@ -17,6 +17,7 @@
 #include "RichardsDensity.h"
 #include "RichardsRelPerm.h"
 #include "RichardsSeff.h"
+#include "RichardsFixedVector.h"
 
 
 class RichardsBorehole;
@@ -119,7 +120,10 @@ protected:
    * d(_mobility)/d(variable_ph)  (variable_ph is the variable for phase=ph)
    * These are used in the jacobian calculations if _fully_upwind = true
    */
-  std::vector<std::vector<Real> > _dmobility_dv;
+  std::vector<RichardsFixed<Real>::Vector> _dmobility_dv;
+
+  /// d(seff)/d(variable_ph) at a node, kept between elements to avoid allocating it each time
+  std::vector<Real> _dseff_dp;
 
 
 
@@ -149,31 +153,31 @@ protected:
   RealVectorValue _borehole_direction;
 
   /// fluid porepressure (or porepressures in case of multiphase)
-  const MaterialProperty<std::vector<Real> > & _pp;
+  const MaterialProperty<RichardsFixed<Real>::Vector> & _pp;
 
   /// d(porepressure_i)/d(variable_j)
-  const MaterialProperty<std::vector<std::vector<Real> > > & _dpp_dv;
+  const MaterialProperty<RichardsFixed<Real>::Matrix> & _dpp_dv;
 
   /// fluid viscosity
-  const MaterialProperty<std::vector<Real> > & _viscosity;
+  const MaterialProperty<RichardsFixed<Real>::Vector> & _viscosity;
 
   /// material permeability
   const MaterialProperty<RealTensorValue> & _permeability;
 
   /// deriviatves of Seff wrt variables
-  const MaterialProperty<std::vector<std::vector<Real> > > & _dseff_dv;
+  const MaterialProperty<RichardsFixed<Real>::Matrix> & _dseff_dv;
 
   /// relative permeability
-  const MaterialProperty<std::vector<Real> > & _rel_perm;
+  const MaterialProperty<RichardsFixed<Real>::Vector> & _rel_perm;
 
   /// d(relperm_i)/d(variable_j)
-  const MaterialProperty<std::vector<std::vector<Real> > > & _drel_perm_dv;
+  const MaterialProperty<RichardsFixed<Real>::Matrix> & _drel_perm_dv;
 
   /// fluid density
-  const MaterialProperty<std::vector<Real> > & _density;
+  const MaterialProperty<RichardsFixed<Real>::Vector> & _density;
 
   /// d(density_i)/d(variable_j)
-  const MaterialProperty<std::vector<std::vector<Real> > > & _ddensity_dv;
+  const MaterialProperty<RichardsFixed<Real>::Matrix> & _ddensity_dv;
 
   /**
    * This is used to hold the total fluid flowing into the borehole
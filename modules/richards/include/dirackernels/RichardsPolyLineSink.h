@@ -13,6 +13,7 @@
 #include "LinearInterpolation.h"
 #include "RichardsSumQuantity.h"
 #include "RichardsVarNames.h"
+#include "RichardsFixedVector.h"
 
 //Forward Declarations
 class RichardsPolyLineSink;
@@ -65,10 +66,10 @@ protected:
   unsigned int _pvar;
 
   /// fluid porepressure (or porepressures in case of multiphase)
-  const MaterialProperty<std::vector<Real> > &_pp;
+  const MaterialProperty<RichardsFixed<Real>::Vector> &_pp;
 
   /// d(porepressure_i)/d(variable_j)
-  const MaterialProperty<std::vector<std::vector<Real> > > &_dpp_dv;
+  const MaterialProperty<RichardsFixed<Real>::Matrix> &_dpp_dv;
 
   /// vector of Dirac Points' x positions
   std::vector<Real> _xs;
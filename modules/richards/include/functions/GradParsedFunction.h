@@ -32,6 +32,9 @@ public:
 
   virtual Real value(Real t, const Point & pt);
 
+  /// Evaluates value() at each of the points
+  virtual void values(Real t, const MooseArray<Point> & points, std::vector<Real> & values);
+
 protected:
 
   /// central difference direction
@@ -11,6 +11,7 @@
 
 #include "Kernel.h"
 #include "RichardsVarNames.h"
+#include "RichardsFixedVector.h"
 
 // Forward Declarations
 class RichardsFlux;
@@ -53,22 +54,22 @@ protected:
   unsigned int _pvar;
 
   /// Richards flux
-  const MaterialProperty<std::vector<RealVectorValue> > &_flux;
+  const MaterialProperty<RichardsFixed<RealVectorValue>::Vector> &_flux;
 
   /// d(Richards flux_i)/d(variable_j), here flux_i is the i_th flux, which is itself a RealVectorValue
-  const MaterialProperty<std::vector<std::vector<RealVectorValue> > > &_dflux_dv;
+  const MaterialProperty<RichardsFixed<RealVectorValue>::Matrix> &_dflux_dv;
 
   /// d(Richards flux_i)/d(grad(variable_j)), here flux_i is the i_th flux, which is itself a RealVectorValue
-  const MaterialProperty<std::vector<std::vector<RealTensorValue> > > &_dflux_dgradv;
+  const MaterialProperty<RichardsFixed<RealTensorValue>::Matrix> &_dflux_dgradv;
 
   /// d^2(Richards flux_i)/d(variable_j)/d(variable_k), here flux_i is the i_th flux, which is itself a RealVectorValue
-  const MaterialProperty<std::vector<std::vector<std::vector<RealVectorValue> > > > &_d2flux_dvdv;
+  const MaterialProperty<RichardsFixed<RealVectorValue>::Array3> &_d2flux_dvdv;
 
   /// d^2(Richards flux_i)/d(grad(variable_j))/d(variable_k), here flux_i is the i_th flux, which is itself a RealVectorValue
-  const MaterialProperty<std::vector<std::vector<std::vector<RealTensorValue> > > > &_d2flux_dgradvdv;
+  const MaterialProperty<RichardsFixed<RealTensorValue>::Array3> &_d2flux_dgradvdv;
 
   /// d^2(Richards flux_i)/d(variable_j)/d(grad(variable_k)), here flux_i is the i_th flux, which is itself a RealVectorValue
-  const MaterialProperty<std::vector<std::vector<std::vector<RealTensorValue> > > > &_d2flux_dvdgradv;
+  const MaterialProperty<RichardsFixed<RealTensorValue>::Array3> &_d2flux_dvdgradv;
 
 
 
@@ -79,13 +80,13 @@ protected:
   VariablePhiSecond & _second_phi;
 
   /// SUPGtau*SUPGvel (a vector of these if multiphase)
-  const MaterialProperty<std::vector<RealVectorValue> >&_tauvel_SUPG;
+  const MaterialProperty<RichardsFixed<RealVectorValue>::Vector>&_tauvel_SUPG;
 
   /// derivative of SUPGtau*SUPGvel_i wrt grad(variable_j)
-  const MaterialProperty<std::vector<std::vector<RealTensorValue> > >&_dtauvel_SUPG_dgradv;
+  const MaterialProperty<RichardsFixed<RealTensorValue>::Matrix>&_dtauvel_SUPG_dgradv;
 
   /// derivative of SUPGtau*SUPGvel_i wrt variable_j
-  const MaterialProperty<std::vector<std::vector<RealVectorValue> > >&_dtauvel_SUPG_dv;
+  const MaterialProperty<RichardsFixed<RealVectorValue>::Matrix>&_dtauvel_SUPG_dv;
 
   /**
    * Computes diagonal and off-diagonal jacobian entries.
@@ -15,6 +15,7 @@
 #include "RichardsRelPerm.h"
 #include "RichardsSeff.h"
 #include "Material.h"
+#include "RichardsFixedVector.h"
 
 // Forward Declarations
 class RichardsFullyUpwindFlux;
@@ -118,16 +119,16 @@ protected:
   const RichardsRelPerm & _relperm_UO;
 
   /// viscosities
-  const MaterialProperty<std::vector<Real> > &_viscosity;
+  const MaterialProperty<RichardsFixed<Real>::Vector> &_viscosity;
 
   /// permeability*(grad(pressure) - density*gravity)  (a vector of these in the multiphase case)
-  const MaterialProperty<std::vector<RealVectorValue> > & _flux_no_mob;
+  const MaterialProperty<RichardsFixed<RealVectorValue>::Vector> & _flux_no_mob;
 
   /// d(_flux_no_mob)/d(variable)
-  const MaterialProperty<std::vector<std::vector<RealVectorValue> > > & _dflux_no_mob_dv;
+  const MaterialProperty<RichardsFixed<RealVectorValue>::Matrix> & _dflux_no_mob_dv;
 
   /// d(_flux_no_mob)/d(grad(variable))
-  const MaterialProperty<std::vector<std::vector<RealTensorValue> > > & _dflux_no_mob_dgradv;
+  const MaterialProperty<RichardsFixed<RealTensorValue>::Matrix> & _dflux_no_mob_dgradv;
 
   /// number of nodes in this element
   unsigned int _num_nodes;
@@ -142,7 +143,10 @@ protected:
    * d(_mobility)/d(variable_ph)  (variable_ph is the variable for phase=ph)
    * These are used in the jacobian calculations
    */
-  std::vector<std::vector<Real> > _dmobility_dv;
+  std::vector<RichardsFixed<Real>::Vector> _dmobility_dv;
+
+  /// d(seff)/d(variable_ph) at a node, kept between elements to avoid allocating it each time
+  std::vector<Real> _dseff_dp;
 
   /**
    * Holds the values of pressures at all the nodes of the element
@@ -11,6 +11,7 @@
 
 #include "TimeDerivative.h"
 #include "RichardsVarNames.h"
+#include "RichardsFixedVector.h"
 
 // Forward Declarations
 class RichardsMassChange;
@@ -37,6 +38,9 @@ protected:
 
   virtual Real computeQpOffDiagJacobian(unsigned int jvar);
 
+  /// The qp methods are overridden, so the batched TimeDerivative loops do not apply
+  virtual bool useBatchedLoops() const { return false; }
+
   /// holds info on the Richards variables
   const RichardsVarNames & _richards_name_UO;
 
@@ -51,22 +55,22 @@ protected:
   bool _use_supg;
 
   /// fluid mass (or fluid masses in multiphase) at quadpoints
-  const MaterialProperty<std::vector<Real> > & _mass;
+  const MaterialProperty<RichardsFixed<Real>::Vector> & _mass;
 
   /// d(fluid mass_i)/d(var_j)
-  const MaterialProperty<std::vector<std::vector<Real> > > & _dmass;
+  const MaterialProperty<RichardsFixed<Real>::Matrix> & _dmass;
 
   /// old value of fluid mass (or fluid masses in multiphase) at quadpoints
-  const MaterialProperty<std::vector<Real> > & _mass_old;
+  const MaterialProperty<RichardsFixed<Real>::Vector> & _mass_old;
 
   /// tau_SUPG
-  const MaterialProperty<std::vector<RealVectorValue> > & _tauvel_SUPG;
+  const MaterialProperty<RichardsFixed<RealVectorValue>::Vector> & _tauvel_SUPG;
 
   /// derivative of tau_SUPG wrt grad(variable)
-  const MaterialProperty<std::vector<std::vector<RealTensorValue> > > & _dtauvel_SUPG_dgradv;
+  const MaterialProperty<RichardsFixed<RealTensorValue>::Matrix> & _dtauvel_SUPG_dgradv;
 
   /// deriv of tau_SUPG wrt variable
-  const MaterialProperty<std::vector<std::vector<RealVectorValue> > > & _dtauvel_SUPG_dv;
+  const MaterialProperty<RichardsFixed<RealVectorValue>::Matrix> & _dtauvel_SUPG_dv;
 
   /**
    * Derivative of residual with respect to wrt_num Richards variable
@@ -17,6 +17,7 @@
 #include "RichardsSeff.h"
 #include "RichardsSat.h"
 #include "RichardsSUPG.h"
+#include "RichardsFixedVector.h"
 
 //Forward Declarations
 class RichardsMaterial;
@@ -113,105 +114,105 @@ protected:
 
 
   /// old values of porepressure(s)
-  MaterialProperty<std::vector<Real> > & _pp_old;
+  MaterialProperty<RichardsFixed<Real>::Vector> & _pp_old;
 
   /// porepressure(s)
-  MaterialProperty<std::vector<Real> > & _pp;
+  MaterialProperty<RichardsFixed<Real>::Vector> & _pp;
 
   /// d(porepressure_i)/d(variable_j)
-  MaterialProperty<std::vector<std::vector<Real> > > & _dpp_dv;
+  MaterialProperty<RichardsFixed<Real>::Matrix> & _dpp_dv;
 
   /// d^2(porepressure_i)/d(variable_j)/d(variable_k)
-  MaterialProperty<std::vector<std::vector<std::vector<Real> > > > & _d2pp_dv;
+  MaterialProperty<RichardsFixed<Real>::Array3> & _d2pp_dv;
 
 
   /// fluid viscosity (or viscosities in the multiphase case)
-  MaterialProperty<std::vector<Real> > & _viscosity;
+  MaterialProperty<RichardsFixed<Real>::Vector> & _viscosity;
 
 
   /// old fluid density (or densities for multiphase problems)
-  MaterialProperty<std::vector<Real> > & _density_old;
+  MaterialProperty<RichardsFixed<Real>::Vector> & _density_old;
 
   /// fluid density (or densities for multiphase problems)
-  MaterialProperty<std::vector<Real> > & _density;
+  MaterialProperty<RichardsFixed<Real>::Vector> & _density;
 
   /// d(density_i)/d(variable_j)
-  MaterialProperty<std::vector<std::vector<Real> > > & _ddensity_dv;
+  MaterialProperty<RichardsFixed<Real>::Matrix> & _ddensity_dv;
 
 
   /// old effective saturation
-  MaterialProperty<std::vector<Real> > & _seff_old;
+  MaterialProperty<RichardsFixed<Real>::Vector> & _seff_old;
 
   /// effective saturation (vector of effective saturations in case of multiphase)
-  MaterialProperty<std::vector<Real> > & _seff; // effective saturation
+  MaterialProperty<RichardsFixed<Real>::Vector> & _seff; // effective saturation
 
   /// d(Seff_i)/d(variable_j)
-  MaterialProperty<std::vector<std::vector<Real> > > & _dseff_dv; // d(seff)/dp
+  MaterialProperty<RichardsFixed<Real>::Matrix> & _dseff_dv; // d(seff)/dp
 
   /// d^2(Seff_i)/d(variable_j)/d(variable_k)
-  MaterialProperty<std::vector<std::vector<std::vector<Real> > > > & _d2seff_dv;
+  MaterialProperty<RichardsFixed<Real>::Array3> & _d2seff_dv;
 
   /// old saturation
-  MaterialProperty<std::vector<Real> > & _sat_old;
+  MaterialProperty<RichardsFixed<Real>::Vector> & _sat_old;
 
   /// saturation (vector of saturations in case of multiphase)
-  MaterialProperty<std::vector<Real> > & _sat;
+  MaterialProperty<RichardsFixed<Real>::Vector> & _sat;
 
   /// d(saturation_i)/d(variable_j)
-  MaterialProperty<std::vector<std::vector<Real> > > & _dsat_dv;
+  MaterialProperty<RichardsFixed<Real>::Matrix> & _dsat_dv;
 
 
   /// relative permeability (vector of relative permeabilities in case of multiphase)
-  MaterialProperty<std::vector<Real> > & _rel_perm;
+  MaterialProperty<RichardsFixed<Real>::Vector> & _rel_perm;
 
   /// d(relperm_i)/d(variable_j)
-  MaterialProperty<std::vector<std::vector<Real> > > & _drel_perm_dv;
+  MaterialProperty<RichardsFixed<Real>::Matrix> & _drel_perm_dv;
 
 
   /// old value of fluid mass (a vector of masses for multicomponent)
-  MaterialProperty<std::vector<Real> > & _mass_old;
+  MaterialProperty<RichardsFixed<Real>::Vector> & _mass_old;
 
   /// fluid mass (a vector of masses for multicomponent)
-  MaterialProperty<std::vector<Real> > & _mass;
+  MaterialProperty<RichardsFixed<Real>::Vector> & _mass;
 
   /// d(fluid mass_i)/dP_j (a vector of masses for multicomponent)
-  MaterialProperty<std::vector<std::vector<Real> > > & _dmass;
+  MaterialProperty<RichardsFixed<Real>::Matrix> & _dmass;
 
 
   /// permeability*(grad(P) - density*gravity)  (a vector of these for multicomponent)
-  MaterialProperty<std::vector<RealVectorValue> > & _flux_no_mob;
+  MaterialProperty<RichardsFixed<RealVectorValue>::Vector> & _flux_no_mob;
 
   /// d(_flux_no_mob_i)/d(variable_j)
-  MaterialProperty<std::vector<std::vector<RealVectorValue> > > & _dflux_no_mob_dv;
+  MaterialProperty<RichardsFixed<RealVectorValue>::Matrix> & _dflux_no_mob_dv;
 
   /// d(_flux_no_mob_i)/d(grad(variable_j))
-  MaterialProperty<std::vector<std::vector<RealTensorValue> > > & _dflux_no_mob_dgradv;
+  MaterialProperty<RichardsFixed<RealTensorValue>::Matrix> & _dflux_no_mob_dgradv;
 
 
   /// fluid flux (a vector of fluxes for multicomponent)
-  MaterialProperty<std::vector<RealVectorValue> > & _flux;
+  MaterialProperty<RichardsFixed<RealVectorValue>::Vector> & _flux;
 
   /// d(Richards flux_i)/d(variable_j), here flux_i is the i_th flux, which is itself a RealVectorValue
-  MaterialProperty<std::vector<std::vector<RealVectorValue> > > & _dflux_dv;
+  MaterialProperty<RichardsFixed<RealVectorValue>::Matrix> & _dflux_dv;
 
   /// d(Richards flux_i)/d(grad(variable_j)), here flux_i is the i_th flux, which is itself a RealVectorValue
-  MaterialProperty<std::vector<std::vector<RealTensorValue> > > & _dflux_dgradv;
+  MaterialProperty<RichardsFixed<RealTensorValue>::Matrix> & _dflux_dgradv;
 
   /// d^2(Richards flux_i)/d(variable_j)/d(variable_k), here flux_i is the i_th flux, which is itself a RealVectorValue
-  MaterialProperty<std::vector<std::vector<std::vector<RealVectorValue> > > > & _d2flux_dvdv;
+  MaterialProperty<RichardsFixed<RealVectorValue>::Array3> & _d2flux_dvdv;
 
   /// d^2(Richards flux_i)/d(grad(variable_j))/d(variable_k), here flux_i is the i_th flux, which is itself a RealVectorValue
-  MaterialProperty<std::vector<std::vector<std::vector<RealTensorValue> > > > & _d2flux_dgradvdv;
+  MaterialProperty<RichardsFixed<RealTensorValue>::Array3> & _d2flux_dgradvdv;
 
   /// d^2(Richards flux_i)/d(variable_j)/d(grad(variable_k)), here flux_i is the i_th flux, which is itself a RealVectorValue.  We should have _d2flux_dvdgradv[i][j][k] = _d2flux_dgradvdv[i][k][j], but i think it is more clear having both, and hopefully not a blowout on memory/CPU.
-  MaterialProperty<std::vector<std::vector<std::vector<RealTensorValue> > > > & _d2flux_dvdgradv;
+  MaterialProperty<RichardsFixed<RealTensorValue>::Array3> & _d2flux_dvdgradv;
 
 
 
 
-  MaterialProperty<std::vector<RealVectorValue> > & _tauvel_SUPG; // tauSUPG * velSUPG
-  MaterialProperty<std::vector<std::vector<RealTensorValue> > > & _dtauvel_SUPG_dgradp; // d (_tauvel_SUPG_i)/d(_grad_variable_j)
-  MaterialProperty<std::vector<std::vector<RealVectorValue> > > & _dtauvel_SUPG_dp; // d (_tauvel_SUPG_i)/d(variable_j)
+  MaterialProperty<RichardsFixed<RealVectorValue>::Vector> & _tauvel_SUPG; // tauSUPG * velSUPG
+  MaterialProperty<RichardsFixed<RealTensorValue>::Matrix> & _dtauvel_SUPG_dgradp; // d (_tauvel_SUPG_i)/d(_grad_variable_j)
+  MaterialProperty<RichardsFixed<RealVectorValue>::Matrix> & _dtauvel_SUPG_dp; // d (_tauvel_SUPG_i)/d(variable_j)
 
   /// d^2(density)/dp_j/dP_k - used in various derivative calculations
   std::vector<std::vector<std::vector<Real> > > _d2density;
@@ -219,6 +220,12 @@ protected:
   /// d^2(relperm_i)/dP_j/dP_k - used in various derivative calculations
   std::vector<std::vector<std::vector<Real> > > _d2rel_perm_dv;
 
+  /// d(seff)/dP_j as computed by a RichardsSeff UserObject, sized once in the constructor
+  std::vector<Real> _dseff_scratch;
+
+  /// d^2(seff)/dP_j/dP_k as computed by a RichardsSeff UserObject, sized once in the constructor
+  std::vector<std::vector<Real> > _d2seff_scratch;
+
 
 
   std::vector<VariableValue *> _pressure_vals;
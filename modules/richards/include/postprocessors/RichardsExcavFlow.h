@@ -12,6 +12,7 @@
 #include "SideIntegralVariablePostprocessor.h"
 #include "MaterialPropertyInterface.h"
 #include "RichardsVarNames.h"
+#include "RichardsFixedVector.h"
 
 //Forward Declarations
 class RichardsExcavFlow;
@@ -39,7 +40,7 @@ protected:
   unsigned int _pvar;
 
   /// mass-flux of fluid (a vector in the multicomponent case)
-  const MaterialProperty<std::vector<RealVectorValue> > &_flux;
+  const MaterialProperty<RichardsFixed<RealVectorValue>::Vector> &_flux;
 
   /// the RichardsExcavGeom that defines where on the boundary we'll compute the mass flux
   Function & _func;
@@ -11,6 +11,7 @@
 
 #include "SideIntegralVariablePostprocessor.h"
 #include "RichardsVarNames.h"
+#include "RichardsFixedVector.h"
 
 class Function;
 
@@ -65,7 +66,7 @@ protected:
   Function & _m_func;
 
   /// porepressure (or porepressure vector for multiphase problems)
-  const MaterialProperty<std::vector<Real> > & _pp;
+  const MaterialProperty<RichardsFixed<Real>::Vector> & _pp;
 
 };
 
@@ -11,6 +11,7 @@
 
 #include "ElementIntegralVariablePostprocessor.h"
 #include "RichardsVarNames.h"
+#include "RichardsFixedVector.h"
 
 //Forward Declarations
 class RichardsMass;
@@ -37,7 +38,7 @@ protected:
   unsigned int _pvar;
 
   /// Mass, or vector of masses in multicomponent situation
-  const MaterialProperty<std::vector<Real> > & _mass;
+  const MaterialProperty<RichardsFixed<Real>::Vector> & _mass;
 };
 
 #endif
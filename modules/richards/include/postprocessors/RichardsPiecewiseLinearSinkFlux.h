@@ -12,6 +12,7 @@
 #include "SideIntegralVariablePostprocessor.h"
 #include "LinearInterpolation.h"
 #include "RichardsVarNames.h"
+#include "RichardsFixedVector.h"
 
 class Function;
 
@@ -62,19 +63,19 @@ protected:
   unsigned int _pvar;
 
   /// porepressure values (only the _pvar component is used)
-  const MaterialProperty<std::vector<Real> > &_pp;
+  const MaterialProperty<RichardsFixed<Real>::Vector> &_pp;
 
   /// fluid viscosity
-  const MaterialProperty<std::vector<Real> > &_viscosity;
+  const MaterialProperty<RichardsFixed<Real>::Vector> &_viscosity;
 
   /// medium permeability
   const MaterialProperty<RealTensorValue> & _permeability;
 
   /// fluid relative permeability
-  const MaterialProperty<std::vector<Real> > &_rel_perm;
+  const MaterialProperty<RichardsFixed<Real>::Vector> &_rel_perm;
 
   /// fluid density
-  const MaterialProperty<std::vector<Real> > &_density;
+  const MaterialProperty<RichardsFixed<Real>::Vector> &_density;
 
 };
 
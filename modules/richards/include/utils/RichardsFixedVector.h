@@ -0,0 +1,100 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+
+#ifndef RICHARDSFIXEDVECTOR_H
+#define RICHARDSFIXEDVECTOR_H
+
+#include "MooseError.h"
+#include "libmesh/vector_value.h"
+#include "libmesh/tensor_value.h"
+
+/// The maximum number of Richards variables (ie, fluid phases) in a simulation
+const unsigned int RICHARDS_MAX_NUM_V = 3;
+
+/**
+ * A vector of at most N entries, stored in place.
+ * It has the subset of the std::vector interface used by the Richards materials and
+ * kernels (size, resize, assign and operator[]) but never allocates, so material
+ * properties of this type do not touch the heap at every quadpoint.  It is a plain
+ * aggregate of its entries, so it can also be used for stateful material properties
+ * and restart.
+ * Like std::vector, resizing sets the new entries to T() and keeps the others.
+ */
+template<typename T, unsigned int N = RICHARDS_MAX_NUM_V>
+class RichardsFixedVector
+{
+public:
+  RichardsFixedVector() :
+      _size(0)
+  {
+  }
+
+  RichardsFixedVector(unsigned int n, const T & value = T()) :
+      _size(0)
+  {
+    assign(n, value);
+  }
+
+  /// The number of entries
+  unsigned int size() const { return _size; }
+
+  /// The maximum number of entries
+  static unsigned int capacity() { return N; }
+
+  bool empty() const { return _size == 0; }
+
+  /// Change the number of entries, the new entries are T()
+  void resize(unsigned int n)
+  {
+    mooseAssert(n <= N, "A RichardsFixedVector can hold at most " << N << " entries, not " << n);
+    for (unsigned int i = _size; i < n; ++i)
+      _vals[i] = T();
+    _size = n;
+  }
+
+  /// Set n entries to value
+  void assign(unsigned int n, const T & value)
+  {
+    mooseAssert(n <= N, "A RichardsFixedVector can hold at most " << N << " entries, not " << n);
+    for (unsigned int i = 0; i < n; ++i)
+      _vals[i] = value;
+    _size = n;
+  }
+
+  T & operator[](unsigned int i)
+  {
+    mooseAssert(i < _size, "Index " << i << " is out of range for a RichardsFixedVector of size " << _size);
+    return _vals[i];
+  }
+
+  const T & operator[](unsigned int i) const
+  {
+    mooseAssert(i < _size, "Index " << i << " is out of range for a RichardsFixedVector of size " << _size);
+    return _vals[i];
+  }
+
+protected:
+  T _vals[N];
+  unsigned int _size;
+};
+
+/**
+ * The fixed size types of the Richards material properties holding a T
+ * for each Richards variable (Vector), pair of variables (Matrix) and triplet
+ * of variables (Array3), eg the derivatives of a fluid quantity with respect to
+ * the Richards variables
+ */
+template<typename T>
+struct RichardsFixed
+{
+  typedef RichardsFixedVector<T> Vector;
+  typedef RichardsFixedVector<Vector> Matrix;
+  typedef RichardsFixedVector<Matrix> Array3;
+};
+
+#endif // RICHARDSFIXEDVECTOR_H
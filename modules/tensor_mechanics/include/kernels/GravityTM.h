@@ -29,6 +29,9 @@ public:
 protected:
   virtual Real computeQpResidual();
 
+  /// The qp methods are overridden, so the batched BodyForce loops do not apply
+  virtual bool useBatchedLoops() const { return false; }
+
   const MaterialProperty<Real> & _density;
 };
 
@@ -0,0 +1,185 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef SYMMETRICRANKFOURTENSOR_H
+#define SYMMETRICRANKFOURTENSOR_H
+
+// Forward declarations
+class RankTwoTensor;
+class SymmetricRankFourTensor;
+
+// MOOSE includes
+#include "Moose.h"
+#include "RankFourTensor.h"
+#include "DerivativeMaterialInterface.h"
+
+// libMesh includes
+#include "libmesh/tensor_value.h"
+
+/**
+ * Helper function template specialization to set an object to zero.
+ * Needed by DerivativeMaterialInterface
+ */
+template<>
+void mooseSetToZero<SymmetricRankFourTensor>(SymmetricRankFourTensor & v);
+
+/**
+ * SymmetricRankFourTensor is a fourth order tensor with the minor symmetries
+ * C_ijkl = C_jikl = C_ijlk, such as an elasticity tensor.
+ *
+ * Only the 36 independent entries are stored, as a 6x6 matrix in Mandel notation:
+ * the pairs of indices are numbered 11 -> 0, 22 -> 1, 33 -> 2, 23 -> 3, 13 -> 4, 12 -> 5
+ * (the Voigt ordering) and the entries involving a shear pair are scaled by sqrt(2) per
+ * shear pair.  With this scaling the double contraction of two tensors is a plain 6x6 matrix
+ * product, the inverse on the space of symmetric tensors is the 6x6 matrix inverse and the
+ * L2 norm is the Frobenius norm of the matrix.  All of the operations work on small fixed
+ * size arrays and do not allocate.
+ *
+ * The contraction with a RankTwoTensor only sees its symmetric part, like the contraction
+ * of a RankFourTensor having the same minor symmetries.
+ */
+class SymmetricRankFourTensor
+{
+public:
+  /// Initialization method
+  enum InitMethod
+  {
+    initNone,
+    initIdentitySymmetricFour
+  };
+
+  /// Default constructor; fills to zero
+  SymmetricRankFourTensor();
+
+  /// Select specific initialization pattern
+  SymmetricRankFourTensor(const InitMethod);
+
+  /**
+   * Fill from vector, see fillFromInputVector.
+   */
+  SymmetricRankFourTensor(const std::vector<Real> & input, RankFourTensor::FillMethod fill_method);
+
+  /**
+   * Construct from a full RankFourTensor.  The tensor is symmetrized over its minor
+   * indices, i.e. 0.25 * (C_ijkl + C_jikl + C_ijlk + C_jilk) is stored.
+   */
+  explicit SymmetricRankFourTensor(const RankFourTensor & a);
+
+  // Named constructors
+  static SymmetricRankFourTensor IdentitySymmetricFour() { return SymmetricRankFourTensor(initIdentitySymmetricFour); }
+
+  /// Gets the value for the index specified.  Takes index = 0,1,2
+  Real operator()(unsigned int i, unsigned int j, unsigned int k, unsigned int l) const;
+
+  /// Gets the Mandel entry for the index pairs a, b = 0,...,5
+  Real & mandel(unsigned int a, unsigned int b) { return _vals[a][b]; }
+
+  /// Gets the Mandel entry for the index pairs a, b = 0,...,5, used for const
+  Real mandel(unsigned int a, unsigned int b) const { return _vals[a][b]; }
+
+  /// The Mandel index (0,...,5) of the index pair i, j
+  static unsigned int mandelIndex(unsigned int i, unsigned int j);
+
+  /// Zeros out the tensor.
+  void zero();
+
+  /// Print the tensor
+  void print() const;
+
+  /// Convert to a full RankFourTensor
+  RankFourTensor toRankFourTensor() const;
+
+  /// C_ijkl*a_kl
+  RankTwoTensor operator* (const RankTwoTensor & a) const;
+
+  /// C_ijkl*a_kl
+  RealTensorValue operator* (const RealTensorValue & a) const;
+
+  /// C_ijkl*a
+  SymmetricRankFourTensor operator* (const Real a) const;
+
+  /// C_ijkl *= a
+  SymmetricRankFourTensor & operator*= (const Real a);
+
+  /// C_ijkl/a
+  SymmetricRankFourTensor operator/ (const Real a) const;
+
+  /// C_ijkl /= a
+  SymmetricRankFourTensor & operator/= (const Real a);
+
+  /// C_ijkl += a_ijkl
+  SymmetricRankFourTensor & operator+= (const SymmetricRankFourTensor & a);
+
+  /// C_ijkl + a_ijkl
+  SymmetricRankFourTensor operator+ (const SymmetricRankFourTensor & a) const;
+
+  /// C_ijkl -= a_ijkl
+  SymmetricRankFourTensor & operator-= (const SymmetricRankFourTensor & a);
+
+  /// C_ijkl - a_ijkl
+  SymmetricRankFourTensor operator- (const SymmetricRankFourTensor & a) const;
+
+  /// -C_ijkl
+  SymmetricRankFourTensor operator- () const;
+
+  /// C_ijpq*a_pqkl
+  SymmetricRankFourTensor operator* (const SymmetricRankFourTensor & a) const;
+
+  /// sqrt(C_ijkl*C_ijkl)
+  Real L2norm() const;
+
+  /**
+   * This returns A_ijkl such that C_ijkl*A_klmn = 0.5*(de_im de_jn + de_in de_jm),
+   * computed by Gauss-Jordan elimination of the 6x6 Mandel matrix.
+   */
+  SymmetricRankFourTensor invSymm() const;
+
+  /**
+   * Rotate the tensor using
+   * C_ijkl = R_im R_jn R_ko R_lp C_mnop
+   * This is done as Q C Q^T with the 6x6 Mandel form Q of the rotation.
+   */
+  void rotate(const RealTensorValue & R);
+
+  /**
+   * Transpose the tensor by swapping the first pair with the second pair of indices
+   * @return C_klij
+   */
+  SymmetricRankFourTensor transposeMajor() const;
+
+  /**
+   * fillFromInputVector takes some number of inputs to fill the tensor.
+   * @param input the numbers that will be placed in the tensor
+   * @param fill_method this can be symmetric9, symmetric21, symmetric_isotropic or
+   *                    axisymmetric_rz, with the same meaning as for RankFourTensor.
+   *                    The other fill methods produce tensors without the minor symmetries.
+   */
+  void fillFromInputVector(const std::vector<Real> & input, RankFourTensor::FillMethod fill_method);
+
+protected:
+  /// Dimensionality of the tensor indices
+  static const unsigned int N = LIBMESH_DIM;
+
+  /// The number of independent index pairs
+  static const unsigned int N2 = 6;
+
+  /// The tensor in Mandel notation
+  Real _vals[N2][N2];
+
+  /// The first and second tensor index of each Mandel index
+  static const unsigned int _first_index[N2];
+  static const unsigned int _second_index[N2];
+
+  /// The Mandel scaling of each index pair, 1 for the normal pairs and sqrt(2) for the shear pairs
+  static const Real _mandel_factor[N2];
+
+  /// Set C_ijkl (and all entries related to it by the minor and major symmetries)
+  void setSymmetric(unsigned int i, unsigned int j, unsigned int k, unsigned int l, Real value);
+};
+
+inline SymmetricRankFourTensor operator*(Real a, const SymmetricRankFourTensor & b) { return b * a; }
+
+#endif //SYMMETRICRANKFOURTENSOR_H
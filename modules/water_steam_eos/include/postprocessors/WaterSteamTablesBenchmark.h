@@ -0,0 +1,53 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef WATERSTEAMTABLESBENCHMARK_H
+#define WATERSTEAMTABLESBENCHMARK_H
+
+#include "GeneralPostprocessor.h"
+#include "WaterSteamTables.h"
+
+class WaterSteamTablesBenchmark;
+
+template<>
+InputParameters validParams<WaterSteamTablesBenchmark>();
+
+/**
+ * Compares the properties interpolated by WaterSteamTables to the ones computed exactly
+ * by the Fortran routines at random points over the range of a table.
+ * Returns the largest relative error of a property, and prints it along with the time
+ * taken per point by the tables and by the Fortran routines.  Fails if the error is above
+ * max_allowed_error.
+ */
+class WaterSteamTablesBenchmark : public GeneralPostprocessor
+{
+public:
+  WaterSteamTablesBenchmark(const std::string & name, InputParameters parameters);
+
+  virtual void initialize();
+  virtual void execute();
+  virtual PostprocessorValue getValue();
+
+protected:
+  const WaterSteamTables & _water_steam_tables;
+
+  /// Whether the (p, h) table is checked, rather than the (p, T) one
+  bool _ph;
+
+  /// The property that is checked
+  unsigned int _property;
+
+  unsigned int _num_points;
+  unsigned int _seed;
+
+  /// The largest relative error the tables may have
+  Real _max_allowed_error;
+
+  /// The largest relative error
+  Real _max_error;
+};
+
+#endif // WATERSTEAMTABLESBENCHMARK_H
@@ -0,0 +1,59 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef WATERSTEAMTABLES_H
+#define WATERSTEAMTABLES_H
+
+#include "GeneralUserObject.h"
+#include "WaterSteamPropertyTables.h"
+
+class WaterSteamTables;
+
+template<>
+InputParameters validParams<WaterSteamTables>();
+
+/**
+ * Provides the IAPWS-97 properties of water and steam from tables (see
+ * WaterSteamPropertyTables) to the materials, kernels, etc. of a simulation.
+ *
+ * The tables are built (or read from file) once, by the copy of the user object
+ * of the first thread, and shared by the copies of all of the threads.
+ */
+class WaterSteamTables : public GeneralUserObject
+{
+public:
+  WaterSteamTables(const std::string & name, InputParameters parameters);
+
+  void initialize();
+  void execute();
+  void finalize();
+
+  /**
+   * The temperature (C), density (kg/m^3) and saturation at pressure p (Pa) and
+   * enthalpy h (MJ/kg), with their derivatives with respect to p and h
+   */
+  void computePH(Real p, Real h, WaterSteamProperties & props) const { _tables->computePH(p, h, props); }
+
+  /// The properties at all of the (p[i], h[i]), eg at all of the quadrature points of an element
+  void computePH(const std::vector<Real> & p, const std::vector<Real> & h, std::vector<WaterSteamProperties> & props) const { _tables->computePH(p, h, props); }
+
+  /**
+   * The enthalpy (J/kg), density (kg/m^3) and viscosity (Pa s) at pressure p (Pa) and
+   * temperature T (C), with their derivatives with respect to p and T
+   */
+  void computePT(Real p, Real T, WaterSteamProperties & props) const { _tables->computePT(p, T, props); }
+
+  /// The properties at all of the (p[i], T[i])
+  void computePT(const std::vector<Real> & p, const std::vector<Real> & T, std::vector<WaterSteamProperties> & props) const { _tables->computePT(p, T, props); }
+
+  /// The tables
+  const WaterSteamPropertyTables & tables() const { return *_tables; }
+
+protected:
+  MooseSharedPointer<const WaterSteamPropertyTables> _tables;
+};
+
+#endif // WATERSTEAMTABLES_H
@@ -0,0 +1,152 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef WATERSTEAMBICUBICTABLE_H
+#define WATERSTEAMBICUBICTABLE_H
+
+#include "Moose.h"
+
+// System includes
+#include <iostream>
+#include <vector>
+
+/// The number of properties held by a water/steam table
+const unsigned int WATER_STEAM_NUM_PROPERTIES = 3;
+
+/**
+ * The properties at a point of a water/steam table, and their derivatives with
+ * respect to the two table variables x and y (eg pressure and enthalpy)
+ */
+struct WaterSteamProperties
+{
+  Real _value[WATER_STEAM_NUM_PROPERTIES];
+  Real _dx[WATER_STEAM_NUM_PROPERTIES];
+  Real _dy[WATER_STEAM_NUM_PROPERTIES];
+
+  /// True if the properties were computed by the IAPWS-97 routines rather than interpolated
+  bool _exact;
+};
+
+/**
+ * Computes the properties a WaterSteamBicubicTable is built from
+ */
+class WaterSteamTableSampler
+{
+public:
+  virtual ~WaterSteamTableSampler() {}
+
+  /**
+   * Computes the properties at (x, y)
+   * @param values the WATER_STEAM_NUM_PROPERTIES properties
+   * @return the phase (or IAPWS-97 region) of the point, or a negative number if the
+   *         properties can not be computed there.  The table does not interpolate
+   *         between points of different phases.
+   */
+  virtual int sample(Real x, Real y, Real * values) const = 0;
+};
+
+/**
+ * Bicubic Hermite interpolation of WATER_STEAM_NUM_PROPERTIES properties on a
+ * tensor product grid.
+ *
+ * The grid is built adaptively: starting from a uniform grid, the intervals of the
+ * cells whose interpolated properties differ from the sampled properties at the cell
+ * centre by more than a relative tolerance are bisected, until all cells are within
+ * the tolerance or the maximum number of refinements is reached.  The cells that are
+ * still not within the tolerance then are not interpolated.
+ *
+ * The derivatives at the nodes are finite differences of the nodal values that only use
+ * the neighbouring nodes of the same phase.  The cells whose corners or centre are not
+ * all of the same phase (eg cells crossed by the saturation line) are not interpolated:
+ * evaluate() returns false for them, and the caller has to compute the properties exactly.
+ *
+ * The table is read only once built, so it may be evaluated from any number of threads.
+ */
+class WaterSteamBicubicTable
+{
+public:
+  WaterSteamBicubicTable();
+
+  /**
+   * Builds the table
+   * @param sampler computes the tabulated properties
+   * @param x_min, x_max, nx the range of x, and the initial number of intervals
+   * @param y_min, y_max, ny the range of y, and the initial number of intervals
+   * @param tolerance the relative error allowed at the cell centres
+   * @param max_refinements the maximum number of times the grid is refined
+   */
+  void build(const WaterSteamTableSampler & sampler,
+             Real x_min, Real x_max, unsigned int nx,
+             Real y_min, Real y_max, unsigned int ny,
+             Real tolerance, unsigned int max_refinements);
+
+  /**
+   * Interpolates the properties and their derivatives at (x, y)
+   * @param hint the cell found by the previous evaluation, used as the first guess of
+   *        the cell containing (x, y); it is updated with the cell of this evaluation
+   * @return false if (x, y) is outside the table or in a cell that is not interpolated,
+   *         in which case props is not set
+   */
+  bool evaluate(Real x, Real y, WaterSteamProperties & props, unsigned int * hint = NULL) const;
+
+  /// The number of nodes along x and y
+  unsigned int numXNodes() const { return _x.size(); }
+  unsigned int numYNodes() const { return _y.size(); }
+
+  /// The number of cells that are not interpolated
+  unsigned int numExactCells() const;
+
+  /// Write the table to a binary stream
+  void write(std::ostream & out) const;
+
+  /**
+   * Read a table written by write()
+   * @return false if the stream does not hold a table, in which case the table is not changed
+   */
+  bool read(std::istream & in);
+
+protected:
+  /// Computes the properties and phases at all of the nodes
+  void sampleNodes(const WaterSteamTableSampler & sampler, std::vector<Real> & values, std::vector<int> & phases) const;
+
+  /// Computes the nodal derivatives from the nodal values, and flags the cells with corners of different phases
+  void computeCoefficients(const std::vector<Real> & values, const std::vector<int> & phases);
+
+  /**
+   * Compares the interpolated properties to the sampled ones at the cell centres.
+   * Flags the cells whose centre is not of the phase of their corners, and the intervals
+   * of the cells that are not within the tolerance.
+   * @param flag_inaccurate whether the cells that are not within the tolerance are flagged
+   *        as not interpolated too
+   * @return true if an interval has to be refined
+   */
+  bool checkCells(const WaterSteamTableSampler & sampler, const std::vector<Real> & values, const std::vector<int> & phases,
+                  Real tolerance, bool flag_inaccurate, std::vector<bool> & refine_x, std::vector<bool> & refine_y);
+
+  /// Bisects the flagged intervals of an axis
+  static void refineAxis(std::vector<Real> & axis, const std::vector<bool> & refine);
+
+  /// The interval of axis holding v, trying hint first
+  static unsigned int findInterval(const std::vector<Real> & axis, Real v, unsigned int hint);
+
+  /// The index of the coefficients of property prop at node (i, j)
+  unsigned int index(unsigned int i, unsigned int j, unsigned int prop) const
+  {
+    return 4 * ((j * _x.size() + i) * WATER_STEAM_NUM_PROPERTIES + prop);
+  }
+
+  /// The nodes along x and y
+  std::vector<Real> _x;
+  std::vector<Real> _y;
+
+  /// The value, the x and y derivatives and the cross derivative of each property at each node
+  std::vector<Real> _coeffs;
+
+  /// Flags the cells that are not interpolated
+  std::vector<char> _exact_cell;
+};
+
+#endif //WATERSTEAMBICUBICTABLE_H
@@ -0,0 +1,158 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef WATERSTEAMPROPERTYTABLES_H
+#define WATERSTEAMPROPERTYTABLES_H
+
+#include "WaterSteamBicubicTable.h"
+
+// System includes
+#include <string>
+
+/**
+ * The IAPWS-97 properties of water and steam, interpolated from bicubic tables
+ * (see WaterSteamBicubicTable) built from the Fortran routines of this module.
+ *
+ * The (p, h) table holds the temperature (C), the density (kg/m^3) and the liquid
+ * saturation as functions of the pressure (Pa) and the enthalpy (in the units of
+ * water_steam_prop_ph, MJ/kg), and the (p, T) table holds the enthalpy (J/kg), the density
+ * (kg/m^3) and the viscosity (Pa s) as functions of the pressure (Pa) and the temperature (C),
+ * as computed by enthalpy_density_pt and viscosity.
+ *
+ * The properties are computed exactly by the Fortran routines outside of the tables and
+ * in the cells of the tables that straddle a phase boundary (the saturation dome, and the
+ * pressure above which water_steam_prop_ph treats water as supercritical).
+ *
+ * The tables may be saved to a binary file, and are read from it instead of being
+ * built when the file was written with the same ranges and tolerance.
+ *
+ * The tables are read only once built, so the properties may be computed from any
+ * number of threads.
+ */
+class WaterSteamPropertyTables
+{
+public:
+  /// The properties of the (p, h) table
+  enum PHProperty
+  {
+    PH_TEMPERATURE = 0,
+    PH_DENSITY = 1,
+    PH_SATURATION = 2
+  };
+
+  /// The properties of the (p, T) table
+  enum PTProperty
+  {
+    PT_ENTHALPY = 0,
+    PT_DENSITY = 1,
+    PT_VISCOSITY = 2
+  };
+
+  /// The range of a table, and its initial number of intervals along each axis
+  struct Range
+  {
+    Real _p_min;
+    Real _p_max;
+    unsigned int _num_p;
+    Real _y_min;
+    Real _y_max;
+    unsigned int _num_y;
+  };
+
+  /**
+   * Builds the tables, or reads them from file_name
+   * @param ph_range the range of the (p, h) table
+   * @param pt_range the range of the (p, T) table
+   * @param tolerance the relative error allowed at the cell centres of the tables
+   * @param max_refinements the maximum number of times the tables are refined
+   * @param file_name the binary file holding the tables, or an empty string
+   * @param write_file whether to write the tables to file_name when they are built
+   */
+  WaterSteamPropertyTables(const Range & ph_range, const Range & pt_range, Real tolerance, unsigned int max_refinements,
+                           const std::string & file_name, bool write_file);
+
+  /**
+   * The properties at pressure p and enthalpy h, with their derivatives with respect to
+   * p (_dx) and h (_dy)
+   */
+  void computePH(Real p, Real h, WaterSteamProperties & props) const;
+
+  /// The properties at all of the (p[i], h[i]), eg at all of the quadrature points of an element
+  void computePH(const std::vector<Real> & p, const std::vector<Real> & h, std::vector<WaterSteamProperties> & props) const;
+
+  /**
+   * The properties at pressure p and temperature T, with their derivatives with respect to
+   * p (_dx) and T (_dy)
+   */
+  void computePT(Real p, Real T, WaterSteamProperties & props) const;
+
+  /// The properties at all of the (p[i], T[i])
+  void computePT(const std::vector<Real> & p, const std::vector<Real> & T, std::vector<WaterSteamProperties> & props) const;
+
+  /// The properties at (p, h) computed by water_steam_prop_ph_ex
+  static void exactPH(Real p, Real h, WaterSteamProperties & props);
+
+  /// The properties at (p, T) computed by enthalpy_density_pt and viscosity
+  static void exactPT(Real p, Real T, WaterSteamProperties & props);
+
+  /**
+   * The phase at (p, h): 1 for water, 2 for steam, 3 for two phases and 4 above the pressure
+   * where water_steam_prop_ph treats water as supercritical
+   */
+  static int samplePH(Real p, Real h, Real * values);
+
+  /**
+   * The IAPWS-97 region at (p, T) (1 for water, 2 for steam).  Returns -1 in the
+   * regions the Fortran routines do not support (region 3, near the critical point).
+   */
+  static int samplePT(Real p, Real T, Real * values);
+
+  /// The ranges of the tables
+  const Range & phRange() const { return _ph_range; }
+  const Range & ptRange() const { return _pt_range; }
+
+  /// The tables
+  const WaterSteamBicubicTable & phTable() const { return _ph_table; }
+  const WaterSteamBicubicTable & ptTable() const { return _pt_table; }
+
+  /// True if the tables were read from the binary file rather than built
+  bool readFromFile() const { return _read_from_file; }
+
+protected:
+  /**
+   * Reads the tables from a file written by writeBinary.
+   * Returns false if the file does not hold tables built with the same ranges and tolerance
+   * (or was written with a different size of Real), in which case nothing is read.
+   */
+  bool readBinary(const std::string & file_name);
+
+  /// Writes the tables, with the ranges and tolerance they were built with
+  void writeBinary(const std::string & file_name) const;
+
+  /**
+   * The properties at (p, h) computed by water_steam_prop_ph_ex, and their derivatives
+   * if dx and dy are not NULL (the pressure derivative of the saturation is set to zero)
+   */
+  static void valuesPH(Real p, Real h, Real * values, Real * dx, Real * dy);
+
+  /// The IAPWS-97 region at (p, T), or -1 if it is not supported
+  static int regionPT(Real p, Real T);
+
+  /// The properties at (p, T) in a given region
+  static void valuesPT(Real p, Real T, int region, Real * values);
+
+  Range _ph_range;
+  Range _pt_range;
+  Real _tolerance;
+  unsigned int _max_refinements;
+
+  WaterSteamBicubicTable _ph_table;
+  WaterSteamBicubicTable _pt_table;
+
+  bool _read_from_file;
+};
+
+#endif //WATERSTEAMPROPERTYTABLES_H
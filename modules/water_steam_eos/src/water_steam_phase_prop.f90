@@ -174,6 +174,7 @@ recursive subroutine water_steam_prop_PH_ex(p, h, T, Sw, &
   logical succ
 
   iphase = 0
+  ierr = 0
 
 ! determine phase condition
   succ= TSAT( p, Ts)
@@ -0,0 +1,90 @@
+# Compares the properties interpolated by the water/steam tables to the
+# ones computed by the Fortran routines, and prints the time taken by both.
+# The run fails if a property has a relative error above 1e-3.
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[UserObjects]
+  [./tables]
+    type = WaterSteamTables
+    num_p = 10
+    num_h = 10
+    num_T = 10
+    tolerance = 1e-4
+    max_refinements = 3
+  [../]
+[]
+
+[Postprocessors]
+  [./ph_density]
+    type = WaterSteamTablesBenchmark
+    water_steam_tables = tables
+    table = ph
+    property = density
+    num_points = 1000
+    max_allowed_error = 1e-3
+  [../]
+  [./ph_temperature]
+    type = WaterSteamTablesBenchmark
+    water_steam_tables = tables
+    table = ph
+    property = temperature
+    num_points = 1000
+    max_allowed_error = 1e-3
+  [../]
+  [./ph_saturation]
+    type = WaterSteamTablesBenchmark
+    water_steam_tables = tables
+    table = ph
+    property = saturation
+    num_points = 1000
+    max_allowed_error = 1e-3
+  [../]
+  [./pt_enthalpy]
+    type = WaterSteamTablesBenchmark
+    water_steam_tables = tables
+    table = pt
+    property = enthalpy
+    num_points = 1000
+    max_allowed_error = 1e-3
+  [../]
+  [./pt_density]
+    type = WaterSteamTablesBenchmark
+    water_steam_tables = tables
+    table = pt
+    property = density
+    num_points = 1000
+    max_allowed_error = 1e-3
+  [../]
+  [./pt_viscosity]
+    type = WaterSteamTablesBenchmark
+    water_steam_tables = tables
+    table = pt
+    property = viscosity
+    num_points = 1000
+    max_allowed_error = 1e-3
+  [../]
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  [./console]
+    type = Console
+    perf_log = false
+  [../]
+[]
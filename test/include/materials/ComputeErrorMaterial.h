@@ -0,0 +1,40 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+#ifndef COMPUTEERRORMATERIAL_H
+#define COMPUTEERRORMATERIAL_H
+
+#include "Material.h"
+
+class ComputeErrorMaterial;
+
+template<>
+InputParameters validParams<ComputeErrorMaterial>();
+
+/**
+ * Declares a property and errors out as soon as it is computed.  Used to check that
+ * materials whose properties are not consumed are not evaluated.
+ */
+class ComputeErrorMaterial : public Material
+{
+public:
+  ComputeErrorMaterial(const std::string & name, InputParameters parameters);
+  virtual ~ComputeErrorMaterial();
+
+protected:
+  void computeQpProperties();
+
+  MaterialProperty<Real> & _prop;
+};
+
+#endif /* COMPUTEERRORMATERIAL_H */
@@ -0,0 +1,88 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./coupled]
+  [../]
+  [./diffusion]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Functions]
+  [./x_fn]
+    type = ParsedFunction
+    value = x
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  # The nodal aux variable coupled by the material, computed before the residual element loop
+  [./coupled]
+    type = FunctionAux
+    variable = coupled
+    function = x_fn
+  [../]
+  # Only the AuxKernel uses the material property
+  [./diffusion]
+    type = MaterialRealAux
+    variable = diffusion
+    property = diffusion
+  [../]
+[]
+
+[Materials]
+  [./var_coupling]
+    type = VarCouplingMaterial
+    block = 0
+    var = coupled
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./integral]
+    type = ElementIntegralVariablePostprocessor
+    variable = diffusion
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = PJFNK
+[]
+
+[Outputs]
+  csv = true
+[]
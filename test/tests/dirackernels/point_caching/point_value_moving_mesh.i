@@ -0,0 +1,140 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  xmin = 0
+  xmax = 1
+  ymin = 0
+  ymax = 1
+  nx = 2
+  ny = 2
+  elem_type = QUAD4
+  uniform_refine = 4
+
+  # Mesh is dispaced by Aux variables computed by predetermined functions
+  displacements = 'disp_x disp_y'
+[]
+
+[Functions]
+  [./disp_x_fn]
+    type = ParsedFunction
+    value = t
+  [../]
+
+  [./disp_y_fn]
+    type = ParsedFunction
+    value = 0
+  [../]
+
+  [./x_fn]
+    type = ParsedFunction
+    value = x
+  [../]
+[]
+
+[Variables]
+  [./u]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+[]
+
+[AuxVariables]
+  [./disp_x]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+
+  [./disp_y]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+
+  # The x coordinate of the nodes in the undisplaced mesh
+  [./reference_x]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+[]
+
+[Kernels]
+  [./time_derivative]
+    type = TimeDerivative
+    variable = u
+  [../]
+
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./disp_x_auxk]
+    type = FunctionAux
+    variable = disp_x
+    function = disp_x_fn
+  [../]
+
+  [./disp_y_auxk]
+    type = FunctionAux
+    variable = disp_y
+    function = disp_y_fn
+  [../]
+
+  [./reference_x_auxk]
+    type = FunctionAux
+    variable = reference_x
+    function = x_fn
+  [../]
+[]
+
+[DiracKernels]
+  [./point_source]
+    type = CachingPointSource
+    variable = u
+    # This is appropriate for this test, since we want the Dirac
+    # points to be found in elements on the displaced Mesh.
+    use_displaced_mesh = true
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = 3
+    value = 0
+  [../]
+
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = 1
+    value = 1
+  [../]
+[]
+
+# The mesh moves by t along x, so the point x = 0.75 of the displaced mesh
+# is in the material point x = 0.75 - t.  This only holds if the point
+# locators of the displaced mesh are rebuilt after it moves.
+[Postprocessors]
+  [./reference_x]
+    type = PointValue
+    variable = reference_x
+    point = '0.75 0.5 0'
+    use_displaced_mesh = true
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'PJFNK'
+  num_steps = 4
+  dt = .1
+[]
+
+[Outputs]
+  output_initial = true
+  csv = true
+[]
@@ -0,0 +1,78 @@
+# A ParsedFunction taking its vals from both a Postprocessor and a scalar variable
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 2
+  ny = 2
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./scalar]
+    family = SCALAR
+    initial_condition = 0
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+  [./time]
+    type = TimeDerivative
+    variable = u
+  [../]
+[]
+
+[AuxScalarKernels]
+  [./scalar_aux]
+    type = FunctionScalarAux
+    variable = scalar
+    function = three
+  [../]
+[]
+
+[Functions]
+  [./two]
+    type = ParsedFunction
+    value = 2
+  [../]
+  [./three]
+    type = ParsedFunction
+    value = 3
+  [../]
+  [./func]
+    type = ParsedFunction
+    value = 'a + 10 * s'
+    vars = 'a s'
+    vals = 'pp scalar'
+  [../]
+[]
+
+[Postprocessors]
+  [./pp]
+    type = FunctionValuePostprocessor
+    function = two
+    execute_on = 'initial timestep_end'
+  [../]
+  [./value]
+    type = FunctionValuePostprocessor
+    function = func
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+  dt = 1
+  solve_type = PJFNK
+[]
+
+[Outputs]
+  csv = true
+[]
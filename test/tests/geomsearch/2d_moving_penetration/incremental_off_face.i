@@ -0,0 +1,131 @@
+# The master block of pl_test1.e starts 3 above its place, beyond the end of the slave
+# boundary, and moves down to 2 above it: the slave nodes stay off the master face, and
+# are held off the search by the incremental search.
+[GlobalParams]
+  order = FIRST
+  family = LAGRANGE
+[]
+
+[Mesh]
+  file = pl_test1.e
+  displacements = 'disp_x disp_y'
+  incremental_penetration_search = true
+[]
+
+[Variables]
+  [./disp_x]
+  [../]
+  [./disp_y]
+  [../]
+[]
+
+[AuxVariables]
+  [./distance]
+  [../]
+[]
+
+[ICs]
+  [./disp_y]
+    type = ConstantIC
+    variable = disp_y
+    value = 3
+    block = 2
+  [../]
+[]
+
+[Kernels]
+  [./diff_x]
+    type = Diffusion
+    variable = disp_x
+  [../]
+  [./diff_y]
+    type = Diffusion
+    variable = disp_y
+  [../]
+[]
+
+[AuxKernels]
+  [./penetrate]
+    type = PenetrationAux
+    variable = distance
+    boundary = 11            #slave
+    paired_boundary = 12     #master
+  [../]
+[]
+
+[BCs]
+  [./b1x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = 1
+    value = 0
+  [../]
+
+  [./b1y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = 1
+    value = 0
+  [../]
+
+  [./b2x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = 2
+    value = 0
+  [../]
+
+  [./b2y]
+    type = FunctionDirichletBC
+    variable = disp_y
+    boundary = 2
+    function = disp_y
+  [../]
+[]
+
+[Functions]
+  [./disp_y]
+    type = PiecewiseLinear
+    x = '0.0 1.0'
+    y = '3.0 2.0'
+  [../]
+[]
+
+[Postprocessors]
+  [./searched]
+    type = NumPenetrationSearchNodes
+    master = 12
+    slave = 11
+  [../]
+  [./skipped]
+    type = NumPenetrationSearchNodes
+    master = 12
+    slave = 11
+    nodes = skipped
+  [../]
+  [./off_face_skipped]
+    type = NumPenetrationSearchNodes
+    master = 12
+    slave = 11
+    nodes = off_face_skipped
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  # Preconditioned JFNK (default)
+  solve_type = 'PJFNK'
+
+  nl_rel_tol = 1e-9
+  l_max_its = 10
+
+  start_time = 0.0
+  dt = 0.25
+  end_time = 1.0
+[]
+
+[Outputs]
+  output_initial = true
+  csv = true
+[]
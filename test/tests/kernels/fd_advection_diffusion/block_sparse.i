@@ -0,0 +1,70 @@
+# The FD Jacobian of the colored element dofs, including the uncoupled block of
+# 'diffusing' and 'diffusing_advected', is compared against the one of PETSc
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 4
+[]
+
+[Variables]
+  [./diffusing_advected]
+    order = FIRST
+    family = LAGRANGE
+    [./InitialCondition]
+      type = FunctionIC
+      function = advected_ic
+    [../]
+  [../]
+
+  [./diffusing]
+    order = FIRST
+    family = LAGRANGE
+    [./InitialCondition]
+      type = FunctionIC
+      function = diffusing_ic
+    [../]
+  [../]
+[]
+
+[Functions]
+  # Zero on the first element, so its element Jacobian has zeros that are nonzero elsewhere
+  [./advected_ic]
+    type = ParsedFunction
+    value = 'if(x > 0.5, x * y, 0)'
+  [../]
+  [./diffusing_ic]
+    type = ParsedFunction
+    value = 'x + 2 * y'
+  [../]
+[]
+
+[Kernels]
+  [./diffuse_diffusing_advected]
+    type = FDDiffusion
+    variable = diffusing_advected
+  [../]
+
+  [./advect_diffusing_advected]
+    type = FDAdvection
+    variable = diffusing_advected
+    advector = diffusing
+  [../]
+
+  [./diffuse_diffusing]
+    type = FDDiffusion
+    variable = diffusing
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+[]
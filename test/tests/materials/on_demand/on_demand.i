@@ -0,0 +1,69 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 4
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = MatCoefDiffusion
+    variable = u
+    conductivity = sum
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Materials]
+  # Only computed because the kernel needs "sum", which needs "a" and "b"
+  [./constant]
+    type = GenericConstantMaterial
+    block = 0
+    prop_names = 'a b'
+    prop_values = '1 2'
+  [../]
+  [./sum]
+    type = SumMaterial
+    block = 0
+    sum_prop_name = sum
+    mp1 = a
+    mp2 = b
+    val1 = 1
+    val2 = 2
+  [../]
+
+  # Nothing uses this property, so this material must never be computed
+  [./unused]
+    type = ComputeErrorMaterial
+    block = 0
+    prop_name = unused
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = 'PJFNK'
+[]
+
+[Outputs]
+  console = true
+[]
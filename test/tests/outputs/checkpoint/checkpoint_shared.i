@@ -0,0 +1,96 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 4
+  distribution = serial
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./prop1]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Kernels]
+  [./heat]
+    type = MatDiffusion
+    variable = u
+    prop_name = thermal_conductivity
+    prop_state = 'old'
+  [../]
+  [./ie]
+    type = TimeDerivative
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./prop1_output]
+    type = MaterialRealAux
+    variable = prop1
+    property = thermal_conductivity
+  [../]
+  [./prop1_output_init]
+    type = MaterialRealAux
+    variable = prop1
+    property = thermal_conductivity
+    execute_on = initial
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Materials]
+  # The property is the sum of its old and older values, so it is only right
+  # after recovering if both of them were read back from the checkpoint
+  [./stateful]
+    type = StatefulTest
+  [../]
+[]
+
+[Postprocessors]
+  [./integral]
+    type = ElementAverageValue
+    variable = prop1
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Executioner]
+  # Preconditioned JFNK (default)
+  type = Transient
+  num_steps = 10
+  dt = 0.1
+  solve_type = PJFNK
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  output_initial = true
+  csv = true
+  [./checkpoints]
+    type = Checkpoint
+    shared_file = true
+  [../]
+[]
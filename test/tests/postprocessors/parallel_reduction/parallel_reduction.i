@@ -0,0 +1,93 @@
+# The solution is u = x, so every postprocessor has an exact value.  The
+# postprocessors gather sums, maxima and minima, which are packed together
+# when they are reduced across the processors.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./integral]
+    type = ElementIntegralVariablePostprocessor
+    variable = u
+  [../]
+  [./average]
+    type = ElementAverageValue
+    variable = u
+  [../]
+  [./right_integral]
+    type = SideIntegralVariablePostprocessor
+    variable = u
+    boundary = right
+  [../]
+  [./element_max]
+    type = ElementExtremeValue
+    variable = u
+  [../]
+  [./element_min]
+    type = ElementExtremeValue
+    variable = u
+    value_type = min
+  [../]
+  [./nodal_sum]
+    type = NodalSum
+    variable = u
+  [../]
+  [./average_nodal]
+    type = AverageNodalVariableValue
+    variable = u
+  [../]
+  [./nodal_max]
+    type = NodalExtremeValue
+    variable = u
+  [../]
+  [./nodal_min]
+    type = NodalExtremeValue
+    variable = u
+    value_type = min
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+
+  # Preconditioned JFNK (default)
+  solve_type = 'PJFNK'
+
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  csv = true
+  print_perf_log = true
+[]
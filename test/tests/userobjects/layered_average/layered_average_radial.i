@@ -0,0 +1,111 @@
+# The field is the square of the distance from the y axis, so each ring has its own average.
+# The elements are cubes, so the average of the field over an element is
+# x_c^2 + z_c^2 + h^2 / 6 with (x_c, z_c) the centroid and h the edge length.
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 4
+  ny = 1
+  nz = 4
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./radius_squared]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./layered_average]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Functions]
+  [./radius_squared]
+    type = ParsedFunction
+    value = 'x * x + z * z'
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./radius_squared]
+    type = FunctionAux
+    variable = radius_squared
+    function = radius_squared
+    execute_on = timestep_begin
+  [../]
+  [./layered_average]
+    type = SpatialUserObjectAux
+    variable = layered_average
+    execute_on = timestep_end
+    user_object = average
+  [../]
+[]
+
+[BCs]
+  [./top]
+    type = DirichletBC
+    variable = u
+    boundary = top
+    value = 1
+  [../]
+  [./bottom]
+    type = DirichletBC
+    variable = u
+    boundary = bottom
+    value = 0
+  [../]
+[]
+
+[UserObjects]
+  [./average]
+    type = LayeredAverage
+    variable = radius_squared
+    direction = y
+    num_layers = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./inner]
+    type = PointValue
+    variable = layered_average
+    point = '0.1 0.5 0.1'
+  [../]
+  [./middle]
+    type = PointValue
+    variable = layered_average
+    point = '0.4 0.5 0.4'
+  [../]
+  [./outer]
+    type = PointValue
+    variable = layered_average
+    point = '0.9 0.5 0.9'
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+
+  # Preconditioned JFNK (default)
+  solve_type = 'PJFNK'
+
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  csv = true
+[]
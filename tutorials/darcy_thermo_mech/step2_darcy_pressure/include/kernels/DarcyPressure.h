@@ -47,6 +47,9 @@ protected:
    */
   virtual Real computeQpJacobian();
 
+  /// The qp methods are overridden, so the batched Diffusion loops do not apply
+  virtual bool useBatchedLoops() const { return false; }
+
   /// Will be set from the input file
   Real _permeability;
   Real _viscosity;
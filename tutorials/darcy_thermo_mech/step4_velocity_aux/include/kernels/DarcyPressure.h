@@ -48,6 +48,9 @@ protected:
    */
   virtual Real computeQpJacobian();
 
+  /// The qp methods are overridden, so the batched Diffusion loops do not apply
+  virtual bool useBatchedLoops() const { return false; }
+
   /**
    * These references will be set by the initialization list so that
    * values can be pulled from the Material system.
@@ -0,0 +1,37 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef ASYNCFILEWRITERTEST_H
+#define ASYNCFILEWRITERTEST_H
+
+//CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+class AsyncFileWriterTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE( AsyncFileWriterTest );
+
+  CPPUNIT_TEST( writeTest );
+  CPPUNIT_TEST( appendTest );
+  CPPUNIT_TEST( removeTest );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void writeTest();
+  void appendTest();
+  void removeTest();
+};
+
+#endif  // ASYNCFILEWRITERTEST_H
@@ -0,0 +1,35 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef GRIDDEDDATATEST_H
+#define GRIDDEDDATATEST_H
+
+//CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+class GriddedDataTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE( GriddedDataTest );
+
+  CPPUNIT_TEST( binaryCacheTest );
+  CPPUNIT_TEST( staleCacheTest );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void binaryCacheTest();
+  void staleCacheTest();
+};
+
+#endif  // GRIDDEDDATATEST_H
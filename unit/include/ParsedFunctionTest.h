@@ -33,6 +33,7 @@ class ParsedFunctionTest : public CppUnit::TestFixture
   CPPUNIT_TEST( advancedConstructor );
   CPPUNIT_TEST( testVariables );
   CPPUNIT_TEST( testConstants );
+  CPPUNIT_TEST( testConstantsParsedDirectly );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -41,6 +42,7 @@ public:
   void advancedConstructor();
   void testVariables();
   void testConstants();
+  void testConstantsParsedDirectly();
 
   void init();
   void finalize();
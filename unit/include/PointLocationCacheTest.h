@@ -0,0 +1,50 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef POINTLOCATIONCACHETEST_H
+#define POINTLOCATIONCACHETEST_H
+
+//CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+// Forward declarations
+class MooseMesh;
+class Factory;
+class MooseApp;
+
+class PointLocationCacheTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE( PointLocationCacheTest );
+
+  CPPUNIT_TEST( cacheHitTest );
+  CPPUNIT_TEST( meshMovedTest );
+  CPPUNIT_TEST( movingPointTest );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void cacheHitTest();
+  void meshMovedTest();
+  void movingPointTest();
+
+  void init();
+  void finalize();
+
+protected:
+  MooseApp * _app;
+  Factory * _factory;
+  MooseMesh * _mesh;
+};
+
+#endif  // POINTLOCATIONCACHETEST_H
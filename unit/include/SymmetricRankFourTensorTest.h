@@ -0,0 +1,65 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef SYMMETRICRANKFOURTENSORTEST_H
+#define SYMMETRICRANKFOURTENSORTEST_H
+
+//CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+// Moose includes
+#include "SymmetricRankFourTensor.h"
+
+class SymmetricRankFourTensorTest : public CppUnit::TestFixture
+{
+
+  CPPUNIT_TEST_SUITE( SymmetricRankFourTensorTest );
+
+  CPPUNIT_TEST( fillTest );
+  CPPUNIT_TEST( conversionTest );
+  CPPUNIT_TEST( L2normTest );
+  CPPUNIT_TEST( contractionTest );
+  CPPUNIT_TEST( productTest );
+  CPPUNIT_TEST( invSymmTest );
+  CPPUNIT_TEST( rotateTest );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  SymmetricRankFourTensorTest();
+  ~SymmetricRankFourTensorTest();
+
+  void fillTest();
+  void conversionTest();
+  void L2normTest();
+  void contractionTest();
+  void productTest();
+  void invSymmTest();
+  void rotateTest();
+
+ private:
+  /// L2 norm of the difference of the two tensors
+  Real difference(const RankFourTensor & a, const RankFourTensor & b);
+
+  std::vector<Real> _input21;
+  std::vector<Real> _input_iso;
+
+  RankFourTensor _full;
+  RankFourTensor _full_iso;
+
+  SymmetricRankFourTensor _symm;
+  SymmetricRankFourTensor _symm_iso;
+};
+
+#endif  // SYMMETRICRANKFOURTENSORTEST_H